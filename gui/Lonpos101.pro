@@ -14,6 +14,20 @@ LIBS += -static -lpthread -static-libgcc -static-libstdc++
 TARGET = Lonpos101
 TEMPLATE = app
 
+INCLUDEPATH += ../solver
+
+# regenerate ../solver/placements.h before the build if the piece set or the generator changed (see solver/Makefile);
+greaterThan(QT_MAJOR_VERSION, 4) {
+    placements.target = $$PWD/../solver/placements.h
+    placements.depends = $$PWD/../solver/gen_placements.c $$PWD/../solver/pieces.txt
+    # written to a temporary file first, so a failed or interrupted generator doesn't leave a truncated header;
+    placements.commands = $$QMAKE_CC -O2 -o gen_placements $$shell_path($$PWD/../solver/gen_placements.c) && \
+        $$shell_path(./gen_placements) $$shell_path($$PWD/../solver/pieces.txt) > placements.h.tmp && \
+        $$QMAKE_MOVE placements.h.tmp $$shell_path($$PWD/../solver/placements.h)
+    QMAKE_EXTRA_TARGETS += placements
+    PRE_TARGETDEPS += $$PWD/../solver/placements.h
+}
+
 
 SOURCES += main.cpp\
         mainwindow.cpp \
@@ -21,11 +35,27 @@ SOURCES += main.cpp\
     boardwidget.cpp \
     piece.cpp \
     rowsolver.cpp \
-    waiter.cpp
+    waiter.cpp \
+    dlxsolver.cpp \
+    solutioncounter.cpp \
+    solutiondatabase.cpp \
+    solutionfile.cpp \
+    solutionindex.cpp \
+    solutionset.cpp \
+    ../solver/dlx.c
 
 HEADERS  += mainwindow.h \
     containerwidget.h \
     boardwidget.h \
     piece.h \
     rowsolver.h \
-    waiter.h
+    waiter.h \
+    dlxsolver.h \
+    solutioncounter.h \
+    solutiondatabase.h \
+    solutionfile.h \
+    solutionindex.h \
+    solutionset.h \
+    ../solver/dlx.h \
+    ../solver/placements.h \
+    ../solver/solution_file.h
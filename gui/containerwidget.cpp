@@ -18,19 +18,20 @@
  *
  ***************************************************************************************/
 
-#include <QFile>
 #include <QGridLayout>
+#include <QMetaType>
 #include <QMessageBox>
 #include <QStringList>
-#include <QTextStream>
 #include "containerwidget.h"
+#include "placements.h"
 
 ContainerWidget::ContainerWidget(QWidget *parent) : QWidget(parent)
 {
-    solutions = new QList<Solution>();
+    solutionsFromDatabase = true;
 
     board = new BoardWidget(this);
     rowsolver = new RowSolver(board);
+    dlxsolver = new DlxSolver();
 
     QGridLayout* layout = new QGridLayout();
 
@@ -90,6 +91,7 @@ ContainerWidget::ContainerWidget(QWidget *parent) : QWidget(parent)
 
     solveButton = new QPushButton(this);
     solveButton->setText("solve");
+    solveButton->setEnabled(false);
     layout->addWidget(solveButton, 1, 9, 1, 1);
 
     solveRowButton = new QPushButton(this);
@@ -99,7 +101,6 @@ ContainerWidget::ContainerWidget(QWidget *parent) : QWidget(parent)
 
     solveBruteForceButton = new QPushButton(this);
     solveBruteForceButton->setText("solve: brute force");
-    solveBruteForceButton->setEnabled(false);
     layout->addWidget(solveBruteForceButton, 3, 9, 1, 1);
 
     solverSpeed = new QLabel(this);
@@ -114,7 +115,6 @@ ContainerWidget::ContainerWidget(QWidget *parent) : QWidget(parent)
     layout->addWidget(solverSpeedSlider, 5, 9, 1, 1);
 
     solutionsLabel = new QLabel(this);
-    solutionsLabel->setText("click solve to find solutions");
     layout->addWidget(solutionsLabel, 9, 8, 1, 2);
 
     goToSolutionButton = new QPushButton(this);
@@ -148,17 +148,53 @@ ContainerWidget::ContainerWidget(QWidget *parent) : QWidget(parent)
     this->connect(goToSolutionButton, SIGNAL(clicked(bool)), this, SLOT(goToSolution(bool)));
     this->connect(solveRowButton, SIGNAL(clicked(bool)), this, SLOT(solveBoardRows(bool)));
     this->connect(solverSpeedSlider, SIGNAL(valueChanged(int)), this, SLOT(updateSolverSpeed(int)));
+    this->connect(solveBruteForceButton, SIGNAL(clicked(bool)), this, SLOT(solveBoardBruteForce(bool)));
+
+    dlxsolver->moveToThread(&workerThread);
+    this->connect(this, SIGNAL(startBruteForce()), dlxsolver, SLOT(start()));
+    this->connect(dlxsolver, SIGNAL(workDone()), this, SLOT(bruteForceFinished()));
+
+    databaseSize = -2;
+    database = new SolutionDatabase();
+    database->moveToThread(&databaseThread);
+    this->connect(&databaseThread, SIGNAL(started()), database, SLOT(load()));
+    this->connect(database, SIGNAL(progress(int)), this, SLOT(databaseProgress(int)));
+    this->connect(database, SIGNAL(loaded(int)), this, SLOT(databaseLoaded(int)));
+
+    query = 0;
+    qRegisterMetaType<QVector<int> >("QVector<int>");
+    counter = new SolutionCounter(database);
+    counter->moveToThread(&counterThread);
+    this->connect(this, SIGNAL(pushPlacement(int,int)), counter, SLOT(push(int,int)));
+    this->connect(this, SIGNAL(popPlacement(int)), counter, SLOT(pop(int)));
+    this->connect(this, SIGNAL(clearPlacements(int)), counter, SLOT(clear(int)));
+    this->connect(this, SIGNAL(requestSolutions()), counter, SLOT(requestSolutions()));
+    this->connect(database, SIGNAL(loaded(int)), counter, SLOT(databaseLoaded(int)));
+    this->connect(counter, SIGNAL(counted(int,int)), this, SLOT(solutionsCounted(int,int)));
+    this->connect(counter, SIGNAL(solutionsReady(QVector<int>)), this, SLOT(solutionsReady(QVector<int>)));
+    counterThread.start();
+
+    databaseThread.start();
 
     clearBoard(true);
 }
 
 ContainerWidget::~ContainerWidget()
 {
-    delete solutions;
+    dlxsolver->cancel();
+    workerThread.quit();
+    workerThread.wait();  // the workers may still run on the thread;
     delete rowsolver;
+    delete dlxsolver;
 
-    workerThread.quit();
-    workerThread.wait(1000);
+    database->cancel();
+    databaseThread.quit();
+    databaseThread.wait();
+
+    counterThread.quit();
+    counterThread.wait();
+    delete counter;
+    delete database;
 }
 
 void ContainerWidget::addPiece(bool b)
@@ -197,6 +233,9 @@ void ContainerWidget::addPiece(bool b)
     if(removeButton->isEnabled() == false) {
         removeButton->setEnabled(true);
     }
+
+    query += 1;
+    emit pushPlacement(DlxSolver::findPlacement(placedPieces.last()), query);
 }
 
 void ContainerWidget::removePiece(bool b)
@@ -218,13 +257,19 @@ void ContainerWidget::removePiece(bool b)
     } else {
         removeButton->setText("remove piece");
         removeButton->setEnabled(false);
+        solutionsLabel->setText(idleText());  // the count of the empty board isn't shown (see solutionsCounted);
     }
+
+    query += 1;
+    emit popPlacement(query);
 }
 
 void ContainerWidget::clearBoard(bool b)
 {
     removeButton->setEnabled(false);
     placedPieces.clear();
+    query += 1;
+    emit clearPlacements(query);
     board->clear();
     for(int i=0; i<12; ++i) {
         pieces.at(i)->clear();
@@ -232,68 +277,50 @@ void ContainerWidget::clearBoard(bool b)
     goToSolutionButton->setEnabled(false);
     previousSolutionButton->setEnabled(false);
     nextSolutionButton->setEnabled(false);
-    solutionsLabel->setText("click solve to find solutions");
+    solutionsLabel->setText(idleText());
 }
 
 void ContainerWidget::solveBoard(bool b)
 {
     QString debugString;
 
-    QList<Piece*> usedPieces;
     for(int i=0; i<12; ++i) {
         if(pieces.at(i)->isUsed()) {
-            usedPieces.append(pieces.at(i));
             debugString = "using piece " + pieces.at(i)->getName() + " @ " + pieces.at(i)->getPattern();
             qDebug(debugString.toStdString().c_str());
         }
     }
 
-//    QFile file(".\\Lonpos101\\data\\combinations.txt");
-    QFile file(".\\..\\Lonpos101\\data\\combinations.txt");
-    if(!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        qDebug("cannot find file.");
-        return;
-    }
-
     goToSolutionButton->setEnabled(false);
     selectSolutionLineEdit->setEnabled(false);
     previousSolutionButton->setEnabled(false);
     nextSolutionButton->setEnabled(false);
-    solutions->clear();
-
-    struct Solution sol;
-    int line_number=1;
-
-    QTextStream in(&file);
-    while (!in.atEnd()) {
-        QString line = in.readLine();
-        QStringList patterns = line.split(',');
-        bool validCombination=true;
-        for(int i=0; i<usedPieces.size(); ++i) {
-            if(usedPieces.at(i)->getPattern() != patterns.at(usedPieces.at(i)->getPosition())) {
-                validCombination=false;
-            }
-        }
-        if(validCombination) {
-            sol.patterns = patterns;
-            sol.id = line_number;
-            solutions->append(sol);
-        }
-        line_number++;
-    }
 
-    debugString = "found "; debugString += QString::number(solutions->size()); debugString += " solutions.";
+    emit requestSolutions();  // counter already knows the solutions of the placed pieces (see addPiece);
+}
+
+void ContainerWidget::solutionsReady(QVector<int> ids)
+{
+    solutions = ids;
+    solutionsFromDatabase = true;
+
+    QString debugString = "found "; debugString += QString::number(solutions.size()); debugString += " solutions.";
     qDebug(debugString.toStdString().c_str());
 
-    if(solutions->size() == 0) {
+    showSolutions();
+}
+
+void ContainerWidget::showSolutions()
+{
+    if(solutions.size() == 0) {
         solutionsLabel->setText("no solutions found");
     } else {
-        solutionsLabel->setText(QString("solution %1 (%2) / %3").arg("1", QString::number(solutions->at(0).id), QString::number(solutions->size())));
+        solutionsLabel->setText(QString("solution %1 (%2) / %3").arg("1", QString::number(solutionId(0)), QString::number(solutions.size())));
         currentSolution=0;
 
         populateBoard();
 
-        if(solutions->size() > 1) {
+        if(solutions.size() > 1) {
             nextSolutionButton->setEnabled(true);
         }
 
@@ -305,7 +332,7 @@ void ContainerWidget::solveBoard(bool b)
 void ContainerWidget::previousSolution(bool b)
 {
     currentSolution -= 1;
-    solutionsLabel->setText(QString("solution %1 (%2) / %3").arg(QString::number(currentSolution+1), QString::number(solutions->at(currentSolution).id), QString::number(solutions->size())));
+    solutionsLabel->setText(QString("solution %1 (%2) / %3").arg(QString::number(currentSolution+1), QString::number(solutionId(currentSolution)), QString::number(solutions.size())));
     populateBoard();
     if(currentSolution == 0) {
         previousSolutionButton->setEnabled(false);
@@ -318,9 +345,9 @@ void ContainerWidget::previousSolution(bool b)
 void ContainerWidget::nextSolution(bool b)
 {
     currentSolution += 1;
-    solutionsLabel->setText(QString("solution %1 (%2) / %3").arg(QString::number(currentSolution+1), QString::number(solutions->at(currentSolution).id), QString::number(solutions->size())));
+    solutionsLabel->setText(QString("solution %1 (%2) / %3").arg(QString::number(currentSolution+1), QString::number(solutionId(currentSolution)), QString::number(solutions.size())));
     populateBoard();
-    if(currentSolution == solutions->size()-1) {
+    if(currentSolution == solutions.size()-1) {
         nextSolutionButton->setEnabled(false);
     }
     if(!previousSolutionButton->isEnabled()) {
@@ -330,11 +357,11 @@ void ContainerWidget::nextSolution(bool b)
 
 void ContainerWidget::goToSolution(bool b)
 {
-    if(selectSolutionLineEdit->text().toInt() > 0 && selectSolutionLineEdit->text().toInt() <= solutions->size()) {
+    if(selectSolutionLineEdit->text().toInt() > 0 && selectSolutionLineEdit->text().toInt() <= solutions.size()) {
         currentSolution = selectSolutionLineEdit->text().toInt()-1;
-        solutionsLabel->setText(QString("solution %1 (%2) / %3").arg(QString::number(currentSolution+1), QString::number(solutions->at(currentSolution).id), QString::number(solutions->size())));
+        solutionsLabel->setText(QString("solution %1 (%2) / %3").arg(QString::number(currentSolution+1), QString::number(solutionId(currentSolution)), QString::number(solutions.size())));
         populateBoard();
-        if(currentSolution == solutions->size()-1) {
+        if(currentSolution == solutions.size()-1) {
             nextSolutionButton->setEnabled(false);
             if(!previousSolutionButton->isEnabled()) {
                 previousSolutionButton->setEnabled(true);
@@ -364,6 +391,37 @@ void ContainerWidget::doNothing(int i)
 {
 }
 
+QString ContainerWidget::idleText() const
+{
+    if(databaseSize == -2) {
+        return "loading solutions...";
+    } else if(databaseSize == -1) {
+        return "no solution database, use brute force";
+    }
+    return "click solve to find solutions";
+}
+
+void ContainerWidget::databaseProgress(int percent)
+{
+    if(solutionsLabel->text().startsWith("loading solutions")) {  // don't overwrite the state of a running solver;
+        solutionsLabel->setText(QString("loading solutions... %1%").arg(percent));
+    }
+}
+
+void ContainerWidget::databaseLoaded(int nsolutions)
+{
+    databaseThread.quit();
+
+    databaseSize = nsolutions;
+    QString debugString = (nsolutions >= 0) ? QString("loaded %1 solutions.").arg(nsolutions) : QString("no solution database found.");
+    qDebug(debugString.toStdString().c_str());
+
+    if(solutionsLabel->text().startsWith("loading solutions")) {
+        solutionsLabel->setText(idleText());
+    }
+    solveButton->setEnabled(databaseSize >= 0 && clearButton->isEnabled());  // unless a solver is running;
+}
+
 void ContainerWidget::updateSolverSpeed(int value)
 {
     solverSpeed->setText(QString("solver speed: x%1").arg(value));
@@ -406,20 +464,93 @@ void ContainerWidget::solverFinished()
     workerThread.quit();
     workerThread.wait(50);
 
-    solutionsLabel->setText("click solve to find solutions");
-    solveButton->setEnabled(true);
+    solutionsLabel->setText(idleText());
+    solveButton->setEnabled(databaseSize >= 0);
     solveRowButton->setEnabled(true);
     clearButton->setEnabled(true);
     addButton->setEnabled(true);
 }
 
+void ContainerWidget::solveBoardBruteForce(bool b)
+{
+    clearButton->setEnabled(false);
+    addButton->setEnabled(false);
+    removeButton->setEnabled(false);
+    solveButton->setEnabled(false);
+    solveBruteForceButton->setEnabled(false);
+    goToSolutionButton->setEnabled(false);
+    selectSolutionLineEdit->setEnabled(false);
+    previousSolutionButton->setEnabled(false);
+    nextSolutionButton->setEnabled(false);
+    solutionsLabel->setText("solving by brute force...");
+
+    dlxsolver->setPlacedPieces(placedPieces);
+
+    workerThread.start();
+    emit startBruteForce();
+}
+
+void ContainerWidget::bruteForceFinished()
+{
+    workerThread.quit();
+    workerThread.wait(50);
+
+    solutions.resize(dlxsolver->solutions.size()/NPIECES);  // the solutions stay in dlxsolver until the next search;
+    for(int i=0; i<solutions.size(); ++i) {
+        solutions[i] = i;
+    }
+    solutionsFromDatabase = false;
+
+    clearButton->setEnabled(true);
+    addButton->setEnabled(true);
+    removeButton->setEnabled(!placedPieces.isEmpty());
+    solveButton->setEnabled(databaseSize >= 0);
+    solveBruteForceButton->setEnabled(true);
+
+    showSolutions();
+}
+
 void ContainerWidget::populateBoard()
 {
     QChar version;
     for(int i=0; i<12; ++i) {
-        pieces.at(i)->setPattern(solutions->at(currentSolution).patterns[i]);
+        int const k = solutionPlacement(currentSolution, i);  // decoded on demand;
+        if(k < 0) continue;  // piece isn't used;
+        pieces.at(i)->setPattern(QString::number(placements[k].used));
         if(pieces.at(i)->getPattern()[0] == '1') version = 'A';
         else version = 'B';
         this->board->changeSite(pieces.at(i), version, pieces.at(i)->getPattern()[2].digitValue(), pieces.at(i)->getPattern()[3].digitValue(), pieces.at(i)->getPattern()[1].digitValue(), false);
     }
 }
+
+// returns the index into placements of the placement of the piece in the n-th solution found;
+int ContainerWidget::solutionPlacement(int n, int piece) const
+{
+    if(solutionsFromDatabase) {
+        return database->placement(solutions.at(n), piece);
+    }
+    return dlxsolver->solutions.at(solutions.at(n)*NPIECES + piece);
+}
+
+// returns the number of the n-th solution found in combinations.txt (or in the order of the brute force search);
+int ContainerWidget::solutionId(int n) const
+{
+    return solutions.at(n)+1;
+}
+
+// shows the number of solutions left (see SolutionCounter) unless the pieces changed since or a solver is running;
+void ContainerWidget::solutionsCounted(int count, int query)
+{
+    if(query != this->query || placedPieces.isEmpty() || !clearButton->isEnabled()) {
+        return;
+    }
+    if(count == SolutionCounter::SOLVABLE) {
+        solutionsLabel->setText("solvable, use brute force to show the solutions");
+    } else if(count == SolutionCounter::UNKNOWN) {
+        solutionsLabel->setText(QString("no solution found within %1 ms").arg(SolutionCounter::BUDGET_MSEC));
+    } else if(count == 0) {
+        solutionsLabel->setText("no solutions");
+    } else {
+        solutionsLabel->setText(QString("%1 solutions, click solve to show them").arg(count));
+    }
+}
@@ -22,8 +22,11 @@
 #define CONTAINERWIDGET_H
 
 #include "boardwidget.h"
+#include "dlxsolver.h"
 #include "piece.h"
 #include "rowsolver.h"
+#include "solutioncounter.h"
+#include "solutiondatabase.h"
 #include <QComboBox>
 #include <QLabel>
 #include <QLineEdit>
@@ -32,6 +35,7 @@
 #include <QSlider>
 #include <QStringList>
 #include <QThread>
+#include <QVector>
 #include <QWidget>
 
 class ContainerWidget : public QWidget
@@ -42,17 +46,20 @@ public:
     ~ContainerWidget();
 
 private:
-    struct Solution {
-        QStringList patterns;
-        int id;
-    };
-
     BoardWidget* board;
-    QList<Solution>* solutions;
+    QVector<int> solutions;  // ids of the solutions found: indices into the database or, after brute force, into the solutions of dlxsolver;
+    bool solutionsFromDatabase;
+    SolutionDatabase* database;
+    QThread databaseThread;
+    int databaseSize;  // number of solutions in the database once it is loaded, -1 if there is none, -2 while loading;
     RowSolver* rowsolver;
+    DlxSolver* dlxsolver;
     QThread workerThread;
 
     QList<Piece*> placedPieces;
+    SolutionCounter* counter;
+    QThread counterThread;
+    int query;  // number of the last change of the placed pieces sent to counter;
 
     QPushButton* clearButton;
     QList<Piece*> pieces;
@@ -78,9 +85,18 @@ private:
     QLabel* solverSpeed;
 
     void populateBoard();
+    void showSolutions();
+    QString idleText() const;
+    int solutionPlacement(int n, int piece) const;
+    int solutionId(int n) const;
 
 signals:
     void startWork();
+    void startBruteForce();
+    void pushPlacement(int placement, int query);
+    void popPlacement(int query);
+    void clearPlacements(int query);
+    void requestSolutions();
 
 public slots:
     void addPiece(bool b);
@@ -93,10 +109,18 @@ public slots:
     void changeSolutionsLabelToSearching(bool b);
     void doNothing(int i);
 
+    void databaseProgress(int percent);
+    void databaseLoaded(int nsolutions);
+    void solutionsCounted(int count, int query);
+    void solutionsReady(QVector<int> ids);
+
     void updateSolverSpeed(int value);
 
     void solveBoardRows(bool b);
     void solverFinished();
+
+    void solveBoardBruteForce(bool b);
+    void bruteForceFinished();
 };
 
 #endif // CONTAINERWIDGET_H
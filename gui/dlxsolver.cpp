@@ -0,0 +1,121 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include "dlx.h"
+#include "dlxsolver.h"
+#include "placements.h"
+
+DlxSolver::DlxSolver(QObject *parent) : QObject(parent), cancelled(0)
+{
+}
+
+DlxSolver::~DlxSolver()
+{
+}
+
+void DlxSolver::setPlacedPieces(QList<Piece*> pieces)
+{
+    placedPieces = pieces;
+}
+
+void DlxSolver::start()
+{
+    solutions.clear();
+
+    struct Dlx* dlx = dlx_create_lonpos(0);
+
+    bool valid = true;
+    for(QList<Piece*>::iterator it=placedPieces.begin(); it!=placedPieces.end(); it+=1) {
+        int row = findPlacement(*it);
+        if(row < 0 || dlx_select_row(dlx, row) != 0) {  // off the board or overlapping pieces;
+            valid = false;
+            break;
+        }
+    }
+
+    if(valid) {
+        dlx->interrupt = &DlxSolver::interrupted;
+        dlx_search(dlx, &DlxSolver::collectSolution, this);
+    }
+
+    dlx_free(dlx);
+
+    emit workDone();
+}
+
+// returns the index into placements, -1 if the pattern does not fit the board;
+// redundant orientations are matched by the sites they occupy, i.e. mapped to the distinct orientation in the table;
+int DlxSolver::findPlacement(Piece *piece)
+{
+    QString pattern = piece->getPattern();
+    int const version = pattern[0].digitValue();
+    int const rotation = pattern[1].digitValue();
+    int const y = pattern.mid(2, pattern.length()-3).toInt();  // y may have two digits;
+    int const x = pattern[pattern.length()-1].digitValue();
+
+    int const y_max = piece->getYRange();
+    int const x_max = piece->getActualXRange();
+    if(y < 0 || y >= BOARD_HEIGHT) return -1;
+
+    uint64_t mask = 0;
+    for(int yy=0; yy<y_max; ++yy) {
+        for(int xx=0; xx<x_max; ++xx) {
+            if(piece->get('A', version == 1 ? xx : x_max-1-xx, yy) != 1) continue;  // version B is mirrored on the y-axis;
+            int row, column;
+            if(rotation == 0) { row = yy; column = xx; }
+            else if(rotation == 1) { row = xx; column = y_max-1-yy; }
+            else if(rotation == 2) { row = y_max-1-yy; column = x_max-1-xx; }
+            else { row = x_max-1-xx; column = yy; }
+            if(y+row >= BOARD_HEIGHT || x+column >= BOARD_WIDTH) return -1;
+            mask |= (uint64_t)1 << (BOARD_WIDTH*(y+row) + x+column);
+        }
+    }
+
+    // all orientations with the same sites have the same bounding box, hence the same top row;
+    int group = piece->getPosition()*BOARD_HEIGHT + y;
+    for(int k=first_placement[group]; k<first_placement[group+1]; ++k) {
+        if(placements[k].mask == mask) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+// may be called from any thread; a running search stops as soon as possible;
+void DlxSolver::cancel()
+{
+    cancelled.fetchAndStoreRelaxed(1);
+}
+
+int DlxSolver::interrupted(void* data)
+{
+    return static_cast<DlxSolver*>(data)->cancelled.testAndSetRelaxed(1, 1);  // atomic read;
+}
+
+void DlxSolver::collectSolution(int const* rows, int nrows, void* data)
+{
+    DlxSolver* solver = static_cast<DlxSolver*>(data);
+
+    int const first = solver->solutions.size();
+    solver->solutions.resize(first + NPIECES);
+    for(int i=0; i<nrows; ++i) {  // each piece is in exactly one row;
+        solver->solutions[first + placements[rows[i]].piece] = rows[i];
+    }
+}
@@ -0,0 +1,58 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef DLXSOLVER_H
+#define DLXSOLVER_H
+
+#include "piece.h"
+#include <QAtomicInt>
+#include <QList>
+#include <QObject>
+#include <QVector>
+
+class DlxSolver : public QObject
+{
+    Q_OBJECT
+public:
+    explicit DlxSolver(QObject *parent = 0);
+    ~DlxSolver();
+
+    void setPlacedPieces(QList<Piece*> pieces);
+    void cancel();
+
+    QVector<qint16> solutions;  // NPIECES placements (index into placements) per solution;
+
+    static int findPlacement(Piece* piece);
+
+private:
+    QList<Piece*> placedPieces;
+    QAtomicInt cancelled;
+
+    static void collectSolution(int const* rows, int nrows, void* data);
+    static int interrupted(void* data);
+
+signals:
+    void workDone();
+
+public slots:
+    void start();
+};
+
+#endif // DLXSOLVER_H
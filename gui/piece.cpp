@@ -19,12 +19,14 @@
  ***************************************************************************************/
 
 #include <QFile>
+#include <QStringList>
 #include "piece.h"
+#include "placements.h"
 
 Piece::Piece()
 {
     for(int y=0; y<4; ++y) {
-        for(int x=0; x<2; ++x) {
+        for(int x=0; x<3; ++x) {
             this->A[y][x] = 0;
             this->B[y][x] = 0;
         }
@@ -164,248 +166,34 @@ Piece* Piece::createPiece(const int nr, QString pattern)
 
     p->position = nr;
 
-    if(nr == 0) {
+    p->name = piece_names[nr];
 
-        p->name = "white";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1); p->set("A", 1, 1);
-
-        p->setYRange(2);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 2;
-        p->x_range_A[2] = 2;
-        p->x_range_A[3] = 1;
-
-    } else if(nr == 1) {
-
-        p->name = "lightgreen";
-
-        p->set("A", 0, 0); p->set("A", 1, 0);
-        p->set("A", 0, 1); p->set("A", 1, 1);
-
-        p->setYRange(2);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 2;
-        p->x_range_A[1] = 2;
-        p->x_range_A[2] = 2;
-        p->x_range_A[3] = 2;
-
-    } else if(nr == 2) {
-
-        p->name = "orange";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1);
-        p->set("A", 0, 2); p->set("A", 1, 2);
-
-                           p->set("B", 1, 0);
-                           p->set("B", 1, 1);
-        p->set("B", 0, 2); p->set("B", 1, 2);
-
-        p->setYRange(3);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 3;
-        p->x_range_A[2] = 2;
-        p->x_range_A[3] = 1;
-
-        p->x_range_B[0] = 1;
-        p->x_range_B[1] = 1;
-        p->x_range_B[2] = 2;
-        p->x_range_B[3] = 3;
-
-    } else if(nr == 3) {
-
-        p->name = "darkblue";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1);
-        p->set("A", 0, 2);
-        p->set("A", 0, 3);
-
-        p->setYRange(4);
-        p->actual_x_range = 1;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 4;
-        p->x_range_A[2] = 1;
-        p->x_range_A[3] = 4;
-
-    } else if(nr == 4) {
-
-        p->name = "grey";
-
-                           p->set("A", 1, 0);
-        p->set("A", 0, 1); p->set("A", 1, 1); p->set("A", 2, 1);
-                           p->set("A", 1, 2);
-
-        p->setYRange(3);
-        p->actual_x_range = 3;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 1;
-        p->x_range_A[2] = 1;
-        p->x_range_A[3] = 1;
-
-    } else if(nr == 5) {
-
-        p->name = "red";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1); p->set("A", 1, 1);
-        p->set("A", 0, 2); p->set("A", 1, 2);
-
-                           p->set("B", 1, 0);
-        p->set("B", 0, 1); p->set("B", 1, 1);
-        p->set("B", 0, 2); p->set("B", 1, 2);
-
-        p->setYRange(3);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 3;
-        p->x_range_A[2] = 2;
-        p->x_range_A[3] = 2;
-
-        p->x_range_B[0] = 1;
-        p->x_range_B[1] = 2;
-        p->x_range_B[2] = 2;
-        p->x_range_B[3] = 3;
-
-    } else if(nr == 6) {
-
-        p->name = "darkgreen";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1); p->set("A", 1, 1);
-                           p->set("A", 1, 2);
-                           p->set("A", 1, 3);
-
-                           p->set("B", 1, 0);
-        p->set("B", 0, 1); p->set("B", 1, 1);
-        p->set("B", 0, 2);
-        p->set("B", 0, 3);
-
-        p->setYRange(4);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 2;
-        p->x_range_A[2] = 1;
-        p->x_range_A[3] = 3;
-
-        p->x_range_B[0] = 1;
-        p->x_range_B[1] = 3;
-        p->x_range_B[2] = 1;
-        p->x_range_B[3] = 2;
-
-    } else if(nr == 7) {
-
-        p->name = "yellow";
-
-        p->set("A", 0, 0); p->set("A", 1, 0);
-        p->set("A", 0, 1);
-        p->set("A", 0, 2); p->set("A", 1, 2);
-
-        p->setYRange(3);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 2;
-        p->x_range_A[1] = 3;
-        p->x_range_A[2] = 2;
-        p->x_range_A[3] = 2;
-
-    } else if(nr == 8) {
-
-        p->name = "lightblue";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1);
-        p->set("A", 0, 2); p->set("A", 1, 2); p->set("A", 2, 2);
-
-        p->setYRange(3);
-        p->actual_x_range = 3;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 3;
-        p->x_range_A[2] = 3;
-        p->x_range_A[3] = 1;
-
-    } else if(nr == 9) {
-
-        p->name = "pink";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1); p->set("A", 1, 1);
-                           p->set("A", 1, 2); p->set("A", 2, 2);
-
-        p->setYRange(3);
-        p->actual_x_range = 3;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 2;
-        p->x_range_A[2] = 2;
-        p->x_range_A[3] = 1;
-
-    } else if(nr == 10) {
-
-        p->name = "pinkish";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1);
-        p->set("A", 0, 2); p->set("A", 1, 2);
-        p->set("A", 0, 3);
-
-                           p->set("B", 1, 0);
-                           p->set("B", 1, 1);
-        p->set("B", 0, 2); p->set("B", 1, 2);
-                           p->set("B", 1, 3);
-
-        p->setYRange(4);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 4;
-        p->x_range_A[2] = 1;
-        p->x_range_A[3] = 1;
-
-        p->x_range_B[0] = 1;
-        p->x_range_B[1] = 1;
-        p->x_range_B[2] = 1;
-        p->x_range_B[3] = 4;
-
-    } else if(nr == 11) {
-
-        p->name = "blue";
-
-        p->set("A", 0, 0);
-        p->set("A", 0, 1);
-        p->set("A", 0, 2);
-        p->set("A", 0, 3); p->set("A", 1, 3);
-
-                           p->set("B", 1, 0);
-                           p->set("B", 1, 1);
-                           p->set("B", 1, 2);
-        p->set("B", 0, 3); p->set("B", 1, 3);
-
-        p->setYRange(4);
-        p->actual_x_range = 2;
-
-        p->x_range_A[0] = 1;
-        p->x_range_A[1] = 4;
-        p->x_range_A[2] = 2;
-        p->x_range_A[3] = 1;
-
-        p->x_range_B[0] = 1;
-        p->x_range_B[1] = 1;
-        p->x_range_B[2] = 2;
-        p->x_range_B[3] = 4;
+    // version A as in the piece set (see pieces.txt), version B mirrored on the y-axis unless it equals a rotation of A;
+    QStringList rows = QString(piece_shapes[nr]).split('/');
+    if(rows.size() > 4 || rows.at(0).length() > 3) {  // A and B hold at most 4 rows of 3 sites;
+        qFatal("piece %s does not fit 4x3 sites, regenerate placements.h with a supported piece set", piece_names[nr]);
+    }
+    p->setYRange(rows.size());
+    p->actual_x_range = rows.at(0).length();
+    for(int y=0; y<rows.size(); ++y) {
+        for(int x=0; x<rows.at(y).length(); ++x) {
+            if(rows.at(y)[x] != '#') continue;
+            p->set("A", x, y);
+            if(piece_mirrored[nr]) p->set("B", p->actual_x_range-1-x, y);
+        }
+    }
 
+    // number of sites in the top row for each rotation: first row, first column, last row, last column;
+    for(int rotation=0; rotation<4; ++rotation) {
+        p->x_range_A[rotation] = 0;
+        p->x_range_B[rotation] = 0;
+        int const n = (rotation%2 == 0) ? p->actual_x_range : p->y_range;
+        for(int i=0; i<n; ++i) {
+            int const x = (rotation == 0 || rotation == 2) ? i : (rotation == 1) ? 0 : p->actual_x_range-1;
+            int const y = (rotation == 1 || rotation == 3) ? i : (rotation == 0) ? 0 : p->y_range-1;
+            p->x_range_A[rotation] += p->A[y][x];
+            p->x_range_B[rotation] += p->B[y][x];
+        }
     }
 
     p->filepath = "./../Lonpos101/images/60x60/" + p->getName() + ".png";
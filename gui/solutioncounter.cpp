@@ -0,0 +1,119 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include "dlx.h"
+#include "solutioncounter.h"
+
+SolutionCounter::SolutionCounter(SolutionDatabase const* database, QObject *parent) : QObject(parent), database(database), indexed(false), query(0), found(false)
+{
+}
+
+void SolutionCounter::push(int placement, int query)
+{
+    this->query = query;
+    selected.append(placement);
+    if(indexed) {
+        sets.append(sets.last().intersected(database->index().solutionsWith(placement)));
+    }
+    count();
+}
+
+void SolutionCounter::pop(int query)
+{
+    this->query = query;
+    selected.removeLast();
+    if(indexed) {
+        sets.removeLast();
+    }
+    count();
+}
+
+void SolutionCounter::clear(int query)
+{
+    this->query = query;
+    selected.clear();
+    if(indexed) {
+        sets.erase(sets.begin()+1, sets.end());
+    }
+    count();
+}
+
+// switches from searching to the index and counts the pieces placed so far again;
+void SolutionCounter::databaseLoaded(int nsolutions)
+{
+    if(nsolutions < 0) {
+        return;
+    }
+    sets.clear();
+    sets.append(SolutionSet::all(nsolutions));
+    for(int i=0; i<selected.size(); ++i) {
+        sets.append(sets.last().intersected(database->index().solutionsWith(selected.at(i))));
+    }
+    indexed = true;
+    count();
+}
+
+// emits the ids of the solutions of the placed pieces (none without database);
+void SolutionCounter::requestSolutions()
+{
+    emit solutionsReady(indexed ? sets.last().ids() : QVector<int>());
+}
+
+void SolutionCounter::count()
+{
+    emit counted(indexed ? sets.last().size() : solveWithDlx(), query);
+}
+
+// returns SOLVABLE, 0 or UNKNOWN;
+int SolutionCounter::solveWithDlx()
+{
+    struct Dlx* dlx = dlx_create_lonpos(0);
+
+    for(int i=0; i<selected.size(); ++i) {
+        if(selected.at(i) < 0 || dlx_select_row(dlx, selected.at(i)) != 0) {  // off the board or overlapping pieces;
+            dlx_free(dlx);
+            return 0;
+        }
+    }
+
+    found = false;
+    timer.start();
+    dlx->interrupt = &SolutionCounter::dlxInterrupted;
+    dlx_search(dlx, &SolutionCounter::dlxSolution, this);
+    bool const stopped = dlx->stopped;
+    dlx_free(dlx);
+
+    if(found) {
+        return SOLVABLE;
+    }
+    return stopped ? UNKNOWN : 0;
+}
+
+void SolutionCounter::dlxSolution(int const* rows, int nrows, void* data)
+{
+    static_cast<SolutionCounter*>(data)->found = true;
+}
+
+// stops the search at the first solution or when the budget is used up;
+int SolutionCounter::dlxInterrupted(void* data)
+{
+    SolutionCounter* counter = static_cast<SolutionCounter*>(data);
+    return counter->found || counter->timer.elapsed() >= BUDGET_MSEC;
+}
@@ -0,0 +1,69 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef SOLUTIONCOUNTER_H
+#define SOLUTIONCOUNTER_H
+
+#include "solutiondatabase.h"
+#include "solutionset.h"
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QVector>
+
+// follows the pieces placed on the board on a worker thread and reports after each change how many solutions are
+// left: from the index of the database once it is loaded (one intersection per piece), otherwise by searching for a
+// single solution with dancing links within BUDGET_MSEC;
+class SolutionCounter : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SolutionCounter(SolutionDatabase const* database, QObject *parent = 0);
+
+    enum { SOLVABLE = -1, UNKNOWN = -2 };  // counts without database: there is a solution / the budget was used up;
+    static int const BUDGET_MSEC = 50;
+
+private:
+    SolutionDatabase const* database;
+    bool indexed;  // the database is loaded and sets mirrors selected;
+    QList<int> selected;  // placements of the placed pieces (index into placements, -1 if off the board);
+    QList<SolutionSet> sets;  // sets[i]: solutions that contain the first i selected placements;
+    int query;  // number of the last request;
+    QElapsedTimer timer;
+    bool found;
+
+    void count();
+    int solveWithDlx();
+    static void dlxSolution(int const* rows, int nrows, void* data);
+    static int dlxInterrupted(void* data);
+
+signals:
+    void counted(int count, int query);
+    void solutionsReady(QVector<int> ids);
+
+public slots:
+    void push(int placement, int query);
+    void pop(int query);
+    void clear(int query);
+    void databaseLoaded(int nsolutions);
+    void requestSolutions();
+};
+
+#endif // SOLUTIONCOUNTER_H
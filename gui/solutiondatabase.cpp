@@ -0,0 +1,200 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include "placements.h"
+#include "solutiondatabase.h"
+#include "solutionfile.h"
+#include <QFile>
+#include <QTextStream>
+#include <stdint.h>
+
+QString const SolutionDatabase::BINARY_PATH = ".\\..\\Lonpos101\\data\\combinations.bin";
+QString const SolutionDatabase::TEXT_PATH = ".\\..\\Lonpos101\\data\\combinations.txt";
+
+SolutionDatabase::SolutionDatabase(QObject *parent) : QObject(parent), ncodes(0), cancelled(0), percent(-1)
+{
+    for(int k=0; k<NPLACEMENTS; ++k) {
+        ncodes = qMax(ncodes, placements[k].used + 1);
+    }
+    codes.fill(-1, 2*NPIECES*ncodes);
+    for(int k=0; k<NPLACEMENTS; ++k) {
+        int const c = 2*(placements[k].piece*ncodes + placements[k].used);
+        codes[(codes.at(c) < 0) ? c : c+1] = k;  // y == 10 is encoded like rotation+1 (see Placement);
+    }
+}
+
+// reads the binary file if there is one, otherwise the text file, and builds the index;
+void SolutionDatabase::load()
+{
+    if(loadBinary(BINARY_PATH) || loadText(TEXT_PATH)) {
+        emit loaded(size());
+    } else {
+        records.clear();
+        solutionIndex.clear();
+        emit loaded(-1);
+    }
+}
+
+bool SolutionDatabase::loadBinary(QString const& path)
+{
+    SolutionFile file;
+    if(!file.open(path)) {
+        return false;
+    }
+
+    records.reserve(file.size()*NPIECES);
+    qint16 record[NPIECES];
+    for(int n=0; n<file.size(); ++n) {
+        if(n % 4096 == 0) {
+            if(isCancelled()) {
+                return false;
+            }
+            reportProgress(n, file.size());
+        }
+        for(int i=0; i<NPIECES; ++i) {
+            int const k = file.placement(n, i);
+            if(k < 0 || k >= NPLACEMENTS || placements[k].piece != i) {  // the offset doesn't belong to the piece;
+                qDebug("invalid record in solution file.");
+                return false;
+            }
+            record[i] = k;
+        }
+        append(record);
+    }
+    return true;
+}
+
+bool SolutionDatabase::loadText(QString const& path)
+{
+    records.clear();
+    solutionIndex.clear();
+
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qDebug("cannot find file.");
+        return false;
+    }
+
+    QTextStream in(&file);
+    qint16 record[NPIECES];
+    for(int n=0; !in.atEnd(); ++n) {
+        if(n % 4096 == 0) {
+            if(isCancelled()) {
+                return false;
+            }
+            reportProgress(file.pos(), file.size());
+        }
+        QString const line = in.readLine();
+        if(line.isEmpty()) {
+            continue;
+        }
+        if(!parseLine(line, record)) {
+            qDebug("invalid line in solution file.");
+            return false;
+        }
+        append(record);
+    }
+    return true;
+}
+
+// converts a line of used codes to placements; a code with y == 10 may also be the next rotation with y == 0, the
+// piece then gets the placement that doesn't overlap the other pieces;
+bool SolutionDatabase::parseLine(QString const& line, qint16* record) const
+{
+    QStringList const fields = line.split(',');
+    if(fields.size() != NPIECES) {
+        return false;
+    }
+
+    uint64_t board = 0;  // sites of the pieces whose placement is unambiguous;
+    int ambiguous[NPIECES];
+    int nambiguous = 0;
+    for(int i=0; i<NPIECES; ++i) {
+        bool ok;
+        int const used = fields.at(i).toInt(&ok);
+        if(!ok || used < 0 || used >= ncodes) {
+            return false;
+        }
+        record[i] = -1;
+        if(used == 0) {
+            continue;
+        }
+        int const c = 2*(i*ncodes + used);
+        if(codes.at(c) < 0) {
+            return false;
+        }
+        if(codes.at(c+1) < 0) {
+            record[i] = codes.at(c);
+            board |= placements[record[i]].mask;
+        } else {
+            ambiguous[nambiguous++] = i;
+        }
+    }
+    for(int j=0; j<nambiguous; ++j) {
+        int const c = 2*(ambiguous[j]*ncodes + fields.at(ambiguous[j]).toInt());
+        record[ambiguous[j]] = (board & placements[codes.at(c)].mask) ? codes.at(c+1) : codes.at(c);
+        board |= placements[record[ambiguous[j]]].mask;
+    }
+    return true;
+}
+
+void SolutionDatabase::append(qint16 const* record)
+{
+    for(int i=0; i<NPIECES; ++i) {
+        records.append(record[i]);
+    }
+    solutionIndex.append(record);
+}
+
+void SolutionDatabase::reportProgress(qint64 done, qint64 total)
+{
+    int const p = (total > 0) ? (int)(100*done/total) : 0;
+    if(p != percent) {
+        percent = p;
+        emit progress(percent);
+    }
+}
+
+// may be called from any thread; load returns as soon as possible without a database;
+void SolutionDatabase::cancel()
+{
+    cancelled.fetchAndStoreRelaxed(1);
+}
+
+bool SolutionDatabase::isCancelled()
+{
+    return cancelled.testAndSetRelaxed(1, 1);  // reads the flag (in Qt 4 and 5);
+}
+
+int SolutionDatabase::size() const
+{
+    return records.size()/NPIECES;
+}
+
+// returns the index into placements of the placement of the piece in solution n (-1 if the piece isn't used);
+int SolutionDatabase::placement(int n, int piece) const
+{
+    return records.at(n*NPIECES + piece);
+}
+
+SolutionIndex const& SolutionDatabase::index() const
+{
+    return solutionIndex;
+}
@@ -0,0 +1,71 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef SOLUTIONDATABASE_H
+#define SOLUTIONDATABASE_H
+
+#include "solutionindex.h"
+#include <QAtomicInt>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// all solutions of the empty board, loaded once (on a worker thread) from combinations.bin or combinations.txt and
+// indexed; read only once loaded was emitted;
+class SolutionDatabase : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SolutionDatabase(QObject *parent = 0);
+
+    static QString const BINARY_PATH;
+    static QString const TEXT_PATH;
+
+    int size() const;
+    int placement(int n, int piece) const;
+    SolutionIndex const& index() const;
+
+    void cancel();
+
+private:
+    QVector<qint16> records;  // NPIECES placements per solution (index into placements, -1: piece not used);
+    QVector<qint16> codes;  // placements of piece i with used code c at 2*(i*ncodes + c) and 2*(i*ncodes + c) + 1 (-1: none);
+    int ncodes;
+    SolutionIndex solutionIndex;
+    QAtomicInt cancelled;
+    int percent;
+
+    bool loadBinary(QString const& path);
+    bool loadText(QString const& path);
+    bool parseLine(QString const& line, qint16* record) const;
+    void append(qint16 const* record);
+    void reportProgress(qint64 done, qint64 total);
+    bool isCancelled();
+
+signals:
+    void progress(int percent);
+    void loaded(int nsolutions);  // -1 if there is no database;
+
+public slots:
+    void load();
+};
+
+#endif // SOLUTIONDATABASE_H
@@ -0,0 +1,83 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include "solution_file.h"
+#include "solutionfile.h"
+#include <cstring>
+
+SolutionFile::SolutionFile() : records(0), nsolutions(0)
+{
+}
+
+SolutionFile::~SolutionFile()
+{
+    close();
+}
+
+// returns false if the file doesn't exist or doesn't match the format and placement table of this build;
+bool SolutionFile::open(QString const& path)
+{
+    close();
+
+    file.setFileName(path);
+    if(!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    struct SolutionFileHeader header;
+    uchar const* data = file.size() >= (qint64)sizeof header ? file.map(0, file.size()) : 0;
+    if(data == 0) {
+        file.close();
+        return false;
+    }
+    memcpy(&header, data, sizeof header);
+
+    if(memcmp(header.magic, SOLUTION_FILE_MAGIC, sizeof header.magic) != 0 || header.version != SOLUTION_FILE_VERSION
+            || header.record_size != SOLUTION_RECORD_SIZE || header.nplacements != NPLACEMENTS
+            || file.size() != (qint64)sizeof header + (qint64)header.nsolutions*SOLUTION_RECORD_SIZE) {
+        qDebug("invalid solution file.");
+        close();
+        return false;
+    }
+
+    records = data + sizeof header;
+    nsolutions = header.nsolutions;
+    return true;
+}
+
+void SolutionFile::close()
+{
+    if(file.isOpen()) {
+        file.close();  // also unmaps the records;
+    }
+    records = 0;
+    nsolutions = 0;
+}
+
+int SolutionFile::size() const
+{
+    return nsolutions;
+}
+
+// returns the index into placements of the placement of the piece in solution n;
+int SolutionFile::placement(int n, int piece) const
+{
+    return decode_solution_record(records + (qint64)n*SOLUTION_RECORD_SIZE, piece);
+}
@@ -0,0 +1,46 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef SOLUTIONFILE_H
+#define SOLUTIONFILE_H
+
+#include <QFile>
+#include <QString>
+
+// read-only view of a binary solution file (see solution_file.h) through a memory map;
+class SolutionFile
+{
+public:
+    SolutionFile();
+    ~SolutionFile();
+
+    bool open(QString const& path);
+    void close();
+
+    int size() const;
+    int placement(int n, int piece) const;
+
+private:
+    QFile file;
+    uchar const* records;
+    int nsolutions;
+};
+
+#endif // SOLUTIONFILE_H
@@ -0,0 +1,61 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include "placements.h"
+#include "solutionindex.h"
+
+SolutionIndex::SolutionIndex() : nsolutions(0)
+{
+}
+
+// adds the next solution: the placement of each piece (index into placements, -1 if the piece isn't used);
+void SolutionIndex::append(qint16 const* record)
+{
+    if(sets.isEmpty()) {
+        sets.fill(SolutionSet(), NPLACEMENTS);
+    }
+    for(int i=0; i<NPIECES; ++i) {
+        if(record[i] >= 0) {
+            sets[record[i]].append(nsolutions);
+        }
+    }
+    nsolutions += 1;
+}
+
+void SolutionIndex::clear()
+{
+    sets.clear();
+    nsolutions = 0;
+}
+
+// returns the number of solutions in the database;
+int SolutionIndex::size() const
+{
+    return nsolutions;
+}
+
+// returns the solutions that contain the placement (index into placements, -1 for no placement);
+SolutionSet const& SolutionIndex::solutionsWith(int placement) const
+{
+    if(placement < 0 || placement >= sets.size()) {
+        return none;
+    }
+    return sets.at(placement);
+}
@@ -0,0 +1,46 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef SOLUTIONINDEX_H
+#define SOLUTIONINDEX_H
+
+#include "solutionset.h"
+#include <QVector>
+
+// inverted index of a solution database: for each placement the set of solutions that contain it, so the solutions
+// of a board with k placed pieces are the intersection of k sets;
+class SolutionIndex
+{
+public:
+    SolutionIndex();
+
+    void append(qint16 const* record);
+    void clear();
+
+    int size() const;
+    SolutionSet const& solutionsWith(int placement) const;
+
+private:
+    QVector<SolutionSet> sets;  // indexed by placement (see placements.h);
+    SolutionSet none;
+    int nsolutions;
+};
+
+#endif // SOLUTIONINDEX_H
@@ -0,0 +1,189 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include "solutionset.h"
+
+SolutionSet::SolutionSet() : count(0)
+{
+}
+
+// returns the set of ids 0 to n-1;
+SolutionSet SolutionSet::all(int n)
+{
+    SolutionSet set;
+    for(int key=0; (key << CHUNK_BITS) < n; ++key) {
+        Chunk chunk;
+        chunk.key = key;
+        chunk.size = qMin(n - (key << CHUNK_BITS), 1 << CHUNK_BITS);
+        chunk.bitmap.fill(0, CHUNK_WORDS);
+        for(int w=0; w<chunk.size/64; ++w) {
+            chunk.bitmap[w] = ~(quint64)0;
+        }
+        if(chunk.size % 64 != 0) {
+            chunk.bitmap[chunk.size/64] = ((quint64)1 << (chunk.size % 64)) - 1;
+        }
+        makeSparse(chunk);
+        set.chunks.append(chunk);
+    }
+    set.count = n;
+    return set;
+}
+
+// adds an id, which must be greater than all ids of the set;
+void SolutionSet::append(int id)
+{
+    int const key = id >> CHUNK_BITS;
+    quint16 const low = id & ((1 << CHUNK_BITS) - 1);
+
+    if(chunks.isEmpty() || chunks.last().key != key) {
+        Chunk chunk;
+        chunk.key = key;
+        chunk.size = 0;
+        chunks.append(chunk);
+    }
+    Chunk& chunk = chunks.last();
+
+    if(chunk.bitmap.isEmpty()) {
+        chunk.array.append(low);
+        if(chunk.array.size() > SPARSE_LIMIT) {  // switch to a bitmap;
+            chunk.bitmap.fill(0, CHUNK_WORDS);
+            for(int i=0; i<chunk.array.size(); ++i) {
+                chunk.bitmap[chunk.array.at(i) >> 6] |= (quint64)1 << (chunk.array.at(i) & 63);
+            }
+            chunk.array.clear();
+        }
+    } else {
+        chunk.bitmap[low >> 6] |= (quint64)1 << (low & 63);
+    }
+    chunk.size += 1;
+    count += 1;
+}
+
+// returns the ids that are in both sets;
+SolutionSet SolutionSet::intersected(SolutionSet const& other) const
+{
+    SolutionSet result;
+    int i = 0, j = 0;
+    while(i < chunks.size() && j < other.chunks.size()) {  // chunks with the same key;
+        if(chunks.at(i).key < other.chunks.at(j).key) {
+            ++i;
+        } else if(chunks.at(i).key > other.chunks.at(j).key) {
+            ++j;
+        } else {
+            Chunk chunk = intersect(chunks.at(i), other.chunks.at(j));
+            if(chunk.size > 0) {
+                result.count += chunk.size;
+                result.chunks.append(chunk);
+            }
+            ++i;
+            ++j;
+        }
+    }
+    return result;
+}
+
+SolutionSet::Chunk SolutionSet::intersect(Chunk const& a, Chunk const& b)
+{
+    Chunk chunk;
+    chunk.key = a.key;
+    chunk.size = 0;
+
+    if(!a.bitmap.isEmpty() && !b.bitmap.isEmpty()) {
+        chunk.bitmap.resize(CHUNK_WORDS);
+        for(int w=0; w<CHUNK_WORDS; ++w) {
+            chunk.bitmap[w] = a.bitmap.at(w) & b.bitmap.at(w);
+            chunk.size += __builtin_popcountll(chunk.bitmap.at(w));
+        }
+        makeSparse(chunk);
+    } else if(!a.bitmap.isEmpty() || !b.bitmap.isEmpty()) {
+        Chunk const& sparse = a.bitmap.isEmpty() ? a : b;
+        Chunk const& dense = a.bitmap.isEmpty() ? b : a;
+        for(int i=0; i<sparse.array.size(); ++i) {
+            quint16 const low = sparse.array.at(i);
+            if(dense.bitmap.at(low >> 6) & ((quint64)1 << (low & 63))) {
+                chunk.array.append(low);
+            }
+        }
+        chunk.size = chunk.array.size();
+    } else {
+        int i = 0, j = 0;
+        while(i < a.array.size() && j < b.array.size()) {
+            if(a.array.at(i) < b.array.at(j)) {
+                ++i;
+            } else if(a.array.at(i) > b.array.at(j)) {
+                ++j;
+            } else {
+                chunk.array.append(a.array.at(i));
+                ++i;
+                ++j;
+            }
+        }
+        chunk.size = chunk.array.size();
+    }
+    return chunk;
+}
+
+// converts a bitmap with few ids to an array;
+void SolutionSet::makeSparse(Chunk& chunk)
+{
+    if(chunk.bitmap.isEmpty() || chunk.size > SPARSE_LIMIT) {
+        return;
+    }
+    chunk.array.reserve(chunk.size);
+    for(int w=0; w<CHUNK_WORDS; ++w) {
+        for(quint64 bits=chunk.bitmap.at(w); bits!=0; bits&=bits-1) {
+            chunk.array.append(w*64 + __builtin_ctzll(bits));
+        }
+    }
+    chunk.bitmap.clear();
+}
+
+int SolutionSet::size() const
+{
+    return count;
+}
+
+bool SolutionSet::isEmpty() const
+{
+    return count == 0;
+}
+
+// returns the ids in ascending order;
+QVector<int> SolutionSet::ids() const
+{
+    QVector<int> ids;
+    ids.reserve(count);
+    for(int c=0; c<chunks.size(); ++c) {
+        Chunk const& chunk = chunks.at(c);
+        int const base = chunk.key << CHUNK_BITS;
+        if(chunk.bitmap.isEmpty()) {
+            for(int i=0; i<chunk.array.size(); ++i) {
+                ids.append(base + chunk.array.at(i));
+            }
+        } else {
+            for(int w=0; w<CHUNK_WORDS; ++w) {
+                for(quint64 bits=chunk.bitmap.at(w); bits!=0; bits&=bits-1) {
+                    ids.append(base + w*64 + __builtin_ctzll(bits));
+                }
+            }
+        }
+    }
+    return ids;
+}
@@ -0,0 +1,58 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef SOLUTIONSET_H
+#define SOLUTIONSET_H
+
+#include <QVector>
+
+// compressed set of solution ids: the ids are split into chunks of 65536, each chunk is stored as a sorted array of
+// the low 16 bits if it is sparse, as a bitmap if it holds more than SPARSE_LIMIT ids;
+class SolutionSet
+{
+public:
+    SolutionSet();
+
+    static SolutionSet all(int n);
+
+    void append(int id);
+    SolutionSet intersected(SolutionSet const& other) const;
+    int size() const;
+    bool isEmpty() const;
+    QVector<int> ids() const;
+
+private:
+    enum { CHUNK_BITS = 16, CHUNK_WORDS = (1 << CHUNK_BITS)/64, SPARSE_LIMIT = 4096 };
+
+    struct Chunk {
+        int key;  // id >> CHUNK_BITS;
+        int size;
+        QVector<quint16> array;  // sorted low bits of the ids if sparse;
+        QVector<quint64> bitmap;  // CHUNK_WORDS words if dense, otherwise empty;
+    };
+
+    QVector<Chunk> chunks;  // ordered by key;
+    int count;
+
+    static Chunk intersect(Chunk const& a, Chunk const& b);
+    static void makeSparse(Chunk& chunk);
+};
+
+#endif // SOLUTIONSET_H
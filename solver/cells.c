@@ -0,0 +1,112 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdint.h>
+#include "solver.h"
+
+
+/**
+ * Chooses the empty site with the fewest placements that cover it and fit on the board.
+ *
+ * @param board -- the bitboard representing the board.
+ * @param pieces -- pointer to the array of all pieces.
+ * @param count -- set to the number of placements covering the chosen site.
+ *
+ * @return the chosen site (y*BOARD_WIDTH + x).
+ *
+ */
+static short fewest_site(uint64_t const board, struct Piece const* pieces, short* count) {
+
+	short best = -1;
+	short best_count = NPLACEMENTS+1;
+
+	for(uint64_t empty = ~board & FULL_BOARD; empty != 0; empty &= empty-1) {
+		short const site = __builtin_ctzll(empty);
+		short n = 0;
+		for(short k=first_covering[site]; k<first_covering[site+1] && n<best_count; ++k) {  // stop counting as soon as the site can't be the best one anymore;
+			struct Placement const* placement = &placements[covering_placements[k]];
+			if(pieces[placement->piece].used == 0 && (board & placement->mask) == 0) n += 1;
+		}
+		if(n < best_count) {
+			best = site;
+			best_count = n;
+			if(n == 0) break;  // the site can't be covered anymore;
+		}
+	}
+
+	*count = best_count;
+	return best;
+}
+
+
+/**
+ * Fills the board site by site: chooses one empty site and branches over all placements (of unused pieces) that cover it.
+ * There is no need to skip pieces, each solution is found exactly once.
+ *
+ * The site is either the first empty one (then only placements starting at that site can cover it) or, if
+ * search->fewest is set, the one with the fewest possible placements.
+ *
+ * @param board -- pointer to the bitboard representing the board.
+ * @param pieces -- pointer to the array of all pieces.
+ * @param search -- pointer to the context of the search.
+ *
+ */
+void iter_cells(uint64_t* board, struct Piece* pieces, struct Search* search) {
+
+	search->stats.nnodes += 1;
+	if(search->budget && (search->stats.nnodes & 0xfff) == 0 && search_interrupted(search)) return;  // poll the clock only every 4096 nodes;
+
+	if(*board == FULL_BOARD) {  // all sites are covered;
+		write_solution(search, pieces);
+		return;
+	}
+
+	short const* candidates;  // placements that cover the chosen site;
+	short ncandidates;
+	if(search->fewest) {
+		short count;
+		short const site = fewest_site(*board, pieces, &count);
+		if(count == 0) return;
+		candidates = covering_placements + first_covering[site];
+		ncandidates = first_covering[site+1] - first_covering[site];
+	} else {
+		short const site = __builtin_ctzll(~*board);  // all preceding sites are covered, so the piece covering this site must start here;
+		candidates = anchored_placements + first_anchored[site];
+		ncandidates = first_anchored[site+1] - first_anchored[site];
+	}
+
+	for(short k=0; k<ncandidates; ++k) {
+
+		struct Placement const* placement = &placements[candidates[k]];
+		struct Piece* piece = &pieces[placement->piece];
+		if(piece->used != 0) continue;  // piece is already on the board;
+		if(search->symmetric && placement->piece == SYMMETRY_PIECE && is_canonical(candidates[k]) == 0) continue;  // a symmetric image of this placement is used instead;
+		if(place_piece_on_board(board, placement) != 0) continue;  // pieces overlap;
+
+		piece->used = placement->used;
+		piece->placement = candidates[k];
+		if(search->prune == 0 || prune_dead_region(*board, placement->mask, pieces, &search->stats) == 0) {
+			iter_cells(board, pieces, search);
+		}
+		remove_piece_from_board(board, placement);
+		piece->used = 0;
+		if(search->stop) return;  // unwind without searching further;
+	}
+}
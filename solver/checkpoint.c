@@ -0,0 +1,117 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "checkpoint.h"
+
+
+/**
+ * @return a hash (FNV-1a) of the used codes of all pieces, which identifies the board a search starts from.
+ */
+uint64_t checkpoint_board_hash(struct Piece const* pieces) {
+
+	uint64_t hash = 14695981039346656037ULL;
+	for(short i=0; i<NPIECES; ++i) {
+		for(short b=0; b<4; ++b) {
+			hash ^= ((unsigned)pieces[i].used >> (8*b)) & 0xff;
+			hash *= 1099511628211ULL;
+		}
+	}
+	return hash;
+}
+
+
+/**
+ * Writes the tasks from next on and the counters of the search; the file is replaced atomically, so a kill during
+ * saving leaves the previous checkpoint intact.
+ *
+ * @param path -- checkpoint file.
+ * @param search -- search whose tasks are run sequentially.
+ * @param next -- index of the first task that is not done yet.
+ * @param offset -- size of the output file after the tasks before next; the output up to there must already be on disk.
+ *
+ * @return 0 on success, -1 if the file couldn't be written.
+ *
+ */
+int checkpoint_save(char const* path, struct Search const* search, int next, long long offset) {
+
+	struct Checkpoint checkpoint = {.version = CHECKPOINT_VERSION, .split_depth = search->split_depth, .prune = search->prune, .symmetric = search->symmetric, .expand = search->expand, .binary = search->binary, .count = search->count, .board_hash = search->board_hash, .ntasks = search->ntasks - next, .offset = offset, .stats = search->stats};
+	memcpy(checkpoint.magic, CHECKPOINT_MAGIC, sizeof checkpoint.magic);
+
+	char tmp[strlen(path) + 5];
+	sprintf(tmp, "%s.tmp", path);
+
+	FILE* fp = fopen(tmp, "wb");
+	if(fp == NULL) return -1;
+	short ok = (fwrite(&checkpoint, sizeof checkpoint, 1, fp) == 1);
+	ok = ok && (fwrite(search->tasks + next, sizeof *(search->tasks), checkpoint.ntasks, fp) == (size_t)checkpoint.ntasks);
+	ok = ok && fflush(fp) == 0 && fsync(fileno(fp)) == 0;  // on disk before it replaces the previous checkpoint;
+	ok = (fclose(fp) == 0) && ok;
+
+	if(ok == 0 || rename(tmp, path) != 0) {
+		remove(tmp);
+		return -1;
+	}
+	return 0;
+}
+
+
+/**
+ * Restores the remaining tasks and the counters of a search from a checkpoint.
+ *
+ * @param path -- checkpoint file.
+ * @param search -- search with the options already set; receives the tasks (allocated with malloc) and the counters.
+ * @param offset -- output: size the output file had at the checkpoint.
+ *
+ * @return 0 on success, -1 if there is no checkpoint, -2 if it is invalid or was written with other options.
+ *
+ */
+int checkpoint_load(char const* path, struct Search* search, long long* offset) {
+
+	FILE* fp = fopen(path, "rb");
+	if(fp == NULL) return -1;
+
+	struct Checkpoint checkpoint;
+	if(fread(&checkpoint, sizeof checkpoint, 1, fp) != 1 || memcmp(checkpoint.magic, CHECKPOINT_MAGIC, sizeof checkpoint.magic) != 0
+			|| checkpoint.version != CHECKPOINT_VERSION || checkpoint.split_depth != search->split_depth || checkpoint.prune != search->prune
+			|| checkpoint.symmetric != search->symmetric || checkpoint.expand != search->expand || checkpoint.binary != search->binary
+			|| checkpoint.count != search->count || checkpoint.board_hash != search->board_hash) {
+		fclose(fp);
+		return -2;
+	}
+
+	struct Task* tasks = malloc((checkpoint.ntasks + 1) * sizeof *tasks);
+	if(fread(tasks, sizeof *tasks, checkpoint.ntasks, fp) != (size_t)checkpoint.ntasks) {
+		free(tasks);
+		fclose(fp);
+		return -2;
+	}
+	fclose(fp);
+
+	search->tasks = tasks;
+	search->ntasks = checkpoint.ntasks;
+	search->max_tasks = checkpoint.ntasks + 1;
+	search->stats = checkpoint.stats;
+	*offset = checkpoint.offset;
+	return 0;
+}
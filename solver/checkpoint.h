@@ -0,0 +1,55 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "solver.h"
+
+/**
+ * Checkpoint of a row search that runs its tasks (see struct Task) one after the other: the tasks that are not done yet
+ * (the frontier of the search), the size of the output written for the finished tasks and the counters so far.
+ *
+ * The file consists of a struct Checkpoint followed by ntasks struct Task; it is only valid for the same build and options.
+ */
+
+#define CHECKPOINT_MAGIC "LPCK"
+#define CHECKPOINT_VERSION 3
+
+struct Checkpoint {
+	char magic[4];  // CHECKPOINT_MAGIC (without terminating zero);
+	int version;  // CHECKPOINT_VERSION;
+	short split_depth;  // options of the search, which must be the same when resuming;
+	short prune;
+	short symmetric;
+	short expand;
+	short binary;
+	short count;
+	uint64_t board_hash;  // pieces placed before the search (see checkpoint_board_hash);
+	int ntasks;  // number of tasks following the header;
+	long long offset;  // size of the output file after the finished tasks;
+	struct Stats stats;  // counters after the finished tasks (including the nodes above split_depth);
+};
+
+uint64_t checkpoint_board_hash(struct Piece const* pieces);
+int checkpoint_save(char const* path, struct Search const* search, int next, long long offset);
+int checkpoint_load(char const* path, struct Search* search, long long* offset);
+
+#endif // CHECKPOINT_H
@@ -0,0 +1,262 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdlib.h>
+#include "dlx.h"
+#include "placements.h"
+
+
+/**
+ * Creates an empty exact cover matrix.
+ *
+ * @param ncolumns -- number of columns (constraints).
+ * @param max_rows -- maximum number of rows (options).
+ * @param max_nodes -- maximum number of non-zero entries over all rows.
+ *
+ * @return pointer to the new matrix; must be released with dlx_free.
+ *
+ */
+struct Dlx* dlx_create(int ncolumns, int max_rows, int max_nodes) {
+
+	struct Dlx* dlx = calloc(1, sizeof *dlx);
+
+	dlx->ncolumns = ncolumns;
+	dlx->max_nodes = 1 + ncolumns + max_nodes;
+	dlx->nodes = calloc(dlx->max_nodes, sizeof *(dlx->nodes));
+	dlx->size = calloc(1 + ncolumns, sizeof *(dlx->size));
+	dlx->covered = calloc(1 + ncolumns, sizeof *(dlx->covered));
+	dlx->row_node = calloc(max_rows, sizeof *(dlx->row_node));
+	dlx->solution = calloc(max_rows, sizeof *(dlx->solution));
+
+	for(int c=0; c<=ncolumns; ++c) {  // link root and column headers horizontally, each header vertically to itself;
+		dlx->nodes[c].left = (c == 0) ? ncolumns : c-1;
+		dlx->nodes[c].right = (c == ncolumns) ? 0 : c+1;
+		dlx->nodes[c].up = c;
+		dlx->nodes[c].down = c;
+		dlx->nodes[c].column = c;
+		dlx->nodes[c].row = -1;
+	}
+	dlx->nnodes = 1 + ncolumns;
+
+	return dlx;
+}
+
+
+/**
+ * Creates the exact cover matrix of Lonpos 101: one column per site (y*BOARD_WIDTH + x) and one column per piece,
+ * one row per placement (row index == index into placements).
+ *
+ * @param symmetric -- if 1, placements of SYMMETRY_PIECE that are not canonical are left out (see is_canonical), so
+ *                     only one out of each four symmetric solutions is found.
+ *
+ * @return pointer to the new matrix; must be released with dlx_free.
+ *
+ * @see placements.h
+ *
+ */
+struct Dlx* dlx_create_lonpos(short symmetric) {
+
+	struct Dlx* dlx = dlx_create(BOARD_HEIGHT*BOARD_WIDTH + NPIECES, NPLACEMENTS, NPLACEMENTS*(PIECE_SIZE+1));
+	int columns[PIECE_SIZE+1];  // sites and piece;
+
+	for(int k=0; k<NPLACEMENTS; ++k) {
+		if(symmetric && placements[k].piece == SYMMETRY_PIECE && (k > symmetric_placements[k][0] || k > symmetric_placements[k][1] || k > symmetric_placements[k][2])) continue;
+		int n = 0;
+		for(int site=0; site<BOARD_HEIGHT*BOARD_WIDTH; ++site) {
+			if(placements[k].mask & ((uint64_t)1 << site)) columns[n++] = site;
+		}
+		columns[n++] = BOARD_HEIGHT*BOARD_WIDTH + placements[k].piece;
+		dlx_add_row(dlx, k, columns, n);
+	}
+
+	return dlx;
+}
+
+
+void dlx_free(struct Dlx* dlx) {
+	free(dlx->nodes);
+	free(dlx->size);
+	free(dlx->covered);
+	free(dlx->row_node);
+	free(dlx->solution);
+	free(dlx);
+}
+
+
+/**
+ * Appends a row to the matrix.
+ *
+ * @param dlx -- pointer to the matrix.
+ * @param row -- index of the row (less than max_rows); reported in solutions and used by dlx_select_row.
+ * @param columns -- (0-based) columns covered by the row.
+ * @param n -- number of columns.
+ *
+ */
+void dlx_add_row(struct Dlx* dlx, int row, int const* columns, int n) {
+
+	int const first = dlx->nnodes;
+
+	for(int i=0; i<n; ++i) {
+		int const c = columns[i] + 1;
+		struct DlxNode* node = &dlx->nodes[first + i];
+
+		node->column = c;
+		node->row = row;
+		node->left = (i == 0) ? first + n-1 : first + i-1;
+		node->right = (i == n-1) ? first : first + i+1;
+		node->up = dlx->nodes[c].up;  // insert at the bottom of the column;
+		node->down = c;
+		dlx->nodes[node->up].down = first + i;
+		dlx->nodes[c].up = first + i;
+		dlx->size[c] += 1;
+	}
+
+	dlx->row_node[row] = first;
+	dlx->nnodes += n;
+}
+
+
+static void cover(struct Dlx* dlx, int c) {
+
+	struct DlxNode* nodes = dlx->nodes;
+
+	nodes[nodes[c].right].left = nodes[c].left;
+	nodes[nodes[c].left].right = nodes[c].right;
+	for(int i=nodes[c].down; i!=c; i=nodes[i].down) {
+		for(int j=nodes[i].right; j!=i; j=nodes[j].right) {
+			nodes[nodes[j].down].up = nodes[j].up;
+			nodes[nodes[j].up].down = nodes[j].down;
+			dlx->size[nodes[j].column] -= 1;
+		}
+	}
+}
+
+
+static void uncover(struct Dlx* dlx, int c) {
+
+	struct DlxNode* nodes = dlx->nodes;
+
+	for(int i=nodes[c].up; i!=c; i=nodes[i].up) {
+		for(int j=nodes[i].left; j!=i; j=nodes[j].left) {
+			dlx->size[nodes[j].column] += 1;
+			nodes[nodes[j].down].up = j;
+			nodes[nodes[j].up].down = j;
+		}
+	}
+	nodes[nodes[c].right].left = c;
+	nodes[nodes[c].left].right = c;
+}
+
+
+/**
+ * Adds a row to the solution before searching, e.g. for pieces that are already placed on the board.
+ *
+ * @param dlx -- pointer to the matrix.
+ * @param row -- index of the row.
+ *
+ * @return 0 if the row was selected, -1 if it conflicts with a previously selected row.
+ *
+ */
+int dlx_select_row(struct Dlx* dlx, int row) {
+
+	int const first = dlx->row_node[row];
+
+	int j = first;
+	do {
+		if(dlx->covered[dlx->nodes[j].column]) return -1;
+		j = dlx->nodes[j].right;
+	} while(j != first);
+
+	do {
+		cover(dlx, dlx->nodes[j].column);
+		dlx->covered[dlx->nodes[j].column] = 1;
+		j = dlx->nodes[j].right;
+	} while(j != first);
+
+	dlx->solution[dlx->depth] = row;
+	dlx->depth += 1;
+
+	return 0;
+}
+
+
+static long long search(struct Dlx* dlx) {
+
+	struct DlxNode* nodes = dlx->nodes;
+
+	dlx->nvisited += 1;
+
+	if(nodes[0].right == 0) {  // all columns are covered;
+		if(dlx->callback != NULL) dlx->callback(dlx->solution, dlx->depth, dlx->data);
+		if(dlx->interrupt != NULL && dlx->interrupt(dlx->data)) dlx->stopped = 1;
+		return 1;
+	}
+	if(dlx->interrupt != NULL && (dlx->nvisited & 0xfff) == 0 && dlx->interrupt(dlx->data)) {
+		dlx->stopped = 1;
+		return 0;
+	}
+
+	int c = nodes[0].right;  // choose the column with the fewest rows (minimum remaining values);
+	for(int j=nodes[c].right; j!=0; j=nodes[j].right) {
+		if(dlx->size[j] < dlx->size[c]) c = j;
+	}
+	if(dlx->size[c] == 0) return 0;  // the column can't be covered anymore;
+
+	long long nsolutions = 0;
+
+	cover(dlx, c);
+	for(int r=nodes[c].down; r!=c; r=nodes[r].down) {
+		dlx->solution[dlx->depth] = nodes[r].row;
+		dlx->depth += 1;
+		for(int j=nodes[r].right; j!=r; j=nodes[j].right) {
+			cover(dlx, nodes[j].column);
+		}
+
+		nsolutions += search(dlx);
+
+		for(int j=nodes[r].left; j!=r; j=nodes[j].left) {
+			uncover(dlx, nodes[j].column);
+		}
+		dlx->depth -= 1;
+		if(dlx->stopped) break;  // unwind, restoring the matrix;
+	}
+	uncover(dlx, c);
+
+	return nsolutions;
+}
+
+
+/**
+ * Finds all exact covers that extend the selected rows.
+ *
+ * @param dlx -- pointer to the matrix.
+ * @param callback -- called with the rows of each solution (including the selected ones); may be NULL to only count them.
+ * @param data -- passed to callback.
+ *
+ * @return number of solutions (found so far if interrupt stopped the search).
+ *
+ */
+long long dlx_search(struct Dlx* dlx, void (*callback)(int const* rows, int nrows, void* data), void* data) {
+
+	dlx->callback = callback;
+	dlx->data = data;
+
+	return search(dlx);
+}
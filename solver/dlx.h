@@ -0,0 +1,72 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef DLX_H
+#define DLX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Exact cover solver based on Knuth's Algorithm X with dancing links.
+ *
+ * The matrix consists of one column per constraint and one row per option; a solution is a set of rows that covers
+ * every column exactly once. The column to branch on is always the one with the fewest remaining rows.
+ */
+
+struct DlxNode {
+	int left;
+	int right;
+	int up;
+	int down;
+	int column;  // index of the column header node;
+	int row;  // index of the row (-1 for column headers);
+};
+
+struct Dlx {
+	struct DlxNode* nodes;  // node 0 is the root, nodes 1..ncolumns are the column headers;
+	int nnodes;
+	int max_nodes;
+	int ncolumns;
+	int* size;  // number of rows currently in each column (indexed by column header node);
+	short* covered;  // indicates whether a column was covered by a selected row (indexed by column header node);
+	int* row_node;  // first node of each row;
+	int* solution;  // rows of the current (partial) solution;
+	int depth;  // number of rows in solution;
+	void (*callback)(int const* rows, int nrows, void* data);  // called for each solution found;
+	void* data;  // passed to callback and interrupt;
+	int (*interrupt)(void* data);  // if not NULL, polled after each solution and every 4096 nodes; non-zero stops the search;
+	short stopped;  // 1 if interrupt stopped the search;
+	long long nvisited;  // number of nodes of the search tree visited so far;
+};
+
+struct Dlx* dlx_create(int ncolumns, int max_rows, int max_nodes);
+struct Dlx* dlx_create_lonpos(short symmetric);
+void dlx_free(struct Dlx* dlx);
+void dlx_add_row(struct Dlx* dlx, int row, int const* columns, int n);
+int dlx_select_row(struct Dlx* dlx, int row);
+long long dlx_search(struct Dlx* dlx, void (*callback)(int const* rows, int nrows, void* data), void* data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DLX_H
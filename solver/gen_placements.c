@@ -0,0 +1,360 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+/**
+ * Generates placements.h, the table of all distinct placements of all pieces on the board.
+ *
+ * Usage:  gcc -o gen_placements gen_placements.c && ./gen_placements [pieces.txt] > placements.h
+ *         (make placements.h does the same, see Makefile; the GUI project regenerates it as well)
+ *
+ * The solver takes the board size and the number of pieces from placements.h, so all bounds are compile-time
+ * constants. To build a solver for another piece set without replacing placements.h, generate the table under another
+ * name and include it first (it has the same include guard, so it takes the place of placements.h everywhere):
+ *
+ *         ./gen_placements pieces_other.txt > placements_other.h
+ *         gcc -O2 -include placements_other.h -o row_solver_other row_solver.c ... -lpthread
+ *
+ * The board and the pieces are read from a piece set file (default: pieces.txt, see there for the format). The
+ * orientations of each piece are derived from its shape (version A); version B is version A mirrored on the y-axis.
+ * Orientations that coincide with a previous one (first all rotations of version A, then all rotations of version B)
+ * are dropped, so no redundancy flags need to be maintained by hand.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PIECES 16
+#define MAX_EXTENT 5  // maximum extent of a piece in either direction;
+#define MAX_PLACEMENTS (MAX_PIECES*8*63)
+
+static short NPIECES;
+static short HEIGHT;
+static short WIDTH;
+
+/**
+ * Version A of every piece, unrotated; rows are listed from top to bottom, '#' denotes a part of the piece.
+ */
+struct Shape {
+	char name[32];
+	char rows[MAX_EXTENT][MAX_EXTENT+1];
+	short height;  // number of rows;
+	short width;  // length of the rows;
+};
+
+static struct Shape shapes[MAX_PIECES];
+
+struct Orientation {
+	uint64_t mask;  // bitboard of the orientation placed with the left upper corner of its enclosing rectangle at (0, 0);
+	short height;  // extent in y-direction;
+	short width;  // extent in x-direction;
+	short distinct;  // 0 if the orientation equals a previous one, 1 otherwise;
+};
+
+
+/**
+ * Reads the board size and the shapes of the pieces.
+ *
+ * @param path -- piece set file.
+ *
+ * @return 0 on success, -1 otherwise (after printing an error message).
+ *
+ */
+static int read_piece_set(char const* path) {
+
+	FILE* fp = fopen(path, "r");
+	if(fp == NULL) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return -1;
+	}
+
+	char line[256];
+	int nline = 0;
+	struct Shape* shape = NULL;
+	while(fgets(line, sizeof line, fp) != NULL) {
+		nline += 1;
+		line[strcspn(line, "\r\n")] = '\0';
+		if(line[0] == ';' || line[0] == '\0') continue;
+
+		if(strncmp(line, "board ", 6) == 0) {
+			if(sscanf(line+6, "%hd %hd", &HEIGHT, &WIDTH) != 2) break;
+		} else if(strncmp(line, "piece ", 6) == 0) {
+			if(NPIECES == MAX_PIECES) break;
+			shape = &shapes[NPIECES++];
+			snprintf(shape->name, sizeof shape->name, "%.31s", line+6);
+		} else if(shape != NULL && strspn(line, "#.") == strlen(line) && shape->height < MAX_EXTENT && strlen(line) <= MAX_EXTENT
+				&& (shape->height == 0 || strlen(line) == (size_t)shape->width)) {
+			strcpy(shape->rows[shape->height], line);
+			shape->width = strlen(line);
+			shape->height += 1;
+		} else {
+			break;
+		}
+	}
+	short const complete = feof(fp);
+	fclose(fp);
+
+	if(complete == 0) {
+		fprintf(stderr, "%s:%d: invalid line (at most %d pieces of at most %dx%d sites)\n", path, nline, MAX_PIECES, MAX_EXTENT, MAX_EXTENT);
+		return -1;
+	}
+	if(HEIGHT <= 0 || WIDTH < MAX_EXTENT || HEIGHT*WIDTH > 63 || NPIECES == 0) {
+		fprintf(stderr, "%s: the board must have a width of at least %d and at most 63 sites, and there must be pieces\n", path, MAX_EXTENT);
+		return -1;
+	}
+	for(short i=0; i<NPIECES; ++i) {
+		if(shapes[i].height == 0) {
+			fprintf(stderr, "%s: piece %s has no rows\n", path, shapes[i].name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+/**
+ * Derives the orientations of a piece for both versions and all rotations and flags the redundant ones.
+ *
+ * @param shape -- version A of the piece.
+ * @param orientations -- output array, indexed by <version>*4 + <rotation> (version 0: A, 1: B).
+ *
+ */
+static void derive_orientations(struct Shape const* shape, struct Orientation* orientations) {
+
+	short const y_max = shape->height;
+	short const x_max = shape->width;
+
+	for(short v=0; v<2; ++v) {
+		struct Orientation* o = orientations + 4*v;
+		for(short rotation=0; rotation<4; ++rotation) {
+			o[rotation].mask = 0;
+			o[rotation].height = (rotation%2 == 0) ? y_max : x_max;
+			o[rotation].width = (rotation%2 == 0) ? x_max : y_max;
+		}
+		for(short y=0; y<y_max; ++y) {
+			for(short x=0; x<x_max; ++x) {
+				if(shape->rows[y][v == 0 ? x : x_max-1-x] != '#') continue;  // version B is mirrored on the y-axis;
+				o[0].mask |= (uint64_t)1 << (WIDTH*y + x);  // 0 degrees;
+				o[1].mask |= (uint64_t)1 << (WIDTH*x + (y_max-1-y));  // 90 degrees;
+				o[2].mask |= (uint64_t)1 << (WIDTH*(y_max-1-y) + (x_max-1-x));  // 180 degrees;
+				o[3].mask |= (uint64_t)1 << (WIDTH*(x_max-1-x) + y);  // 270 degrees;
+			}
+		}
+	}
+
+	for(short i=0; i<8; ++i) {
+		orientations[i].distinct = 1;
+		for(short j=0; j<i; ++j) {
+			if(orientations[j].mask == orientations[i].mask) {
+				orientations[i].distinct = 0;
+				break;
+			}
+		}
+	}
+}
+
+
+int main (int argc, char** argv) {
+
+	if(read_piece_set((argc > 1) ? argv[1] : "pieces.txt") != 0) return 1;
+
+	struct Orientation orientations[MAX_PIECES][8];
+	for(short i=0; i<NPIECES; ++i) {
+		derive_orientations(&shapes[i], orientations[i]);
+	}
+
+	printf("/* Generated by gen_placements.c -- do not edit. */\n\n");
+	printf("#ifndef PLACEMENTS_H\n#define PLACEMENTS_H\n\n#include <stdint.h>\n\n");
+	short extent = 0, size = 0;  // maximum over all pieces;
+	for(short i=0; i<NPIECES; ++i) {
+		extent = (shapes[i].height > extent) ? shapes[i].height : extent;
+		extent = (shapes[i].width > extent) ? shapes[i].width : extent;
+		size = (__builtin_popcountll(orientations[i][0].mask) > size) ? __builtin_popcountll(orientations[i][0].mask) : size;
+	}
+	printf("#define NPIECES %d\n#define BOARD_HEIGHT %d\n#define BOARD_WIDTH %d\n", NPIECES, HEIGHT, WIDTH);
+	printf("#define PIECE_EXTENT %d  // maximum extent of a piece in either direction;\n", extent);
+	printf("#define PIECE_SIZE %d  // maximum number of sites of a piece;\n\n", size);
+	printf("struct Placement {\n");
+	printf("\tuint64_t mask;  // sites occupied by the piece, see ROW_MASK;\n");
+	printf("\tint used;  // <version>*1000 + <rotation>*100 + <y>*10 + <x> (where <version> is 1 for A and 2 for B);\n");
+	printf("\tshort piece;  // index of the piece;\n");
+	printf("};\n\n");
+
+	/**
+	 * Placements are grouped by piece and by the row of the left upper corner of their enclosing rectangle; within a group
+	 * they are ordered by rotation, then version, then x, which is the order in which the row solver tries them.
+	 */
+	static int first[MAX_PIECES*64 + 1];  // also used per site below;
+	static uint64_t placement_masks[MAX_PLACEMENTS];
+	static short placement_pieces[MAX_PLACEMENTS];
+	int first_placement_of_piece[MAX_PIECES + 1];
+	int n = 0;
+
+	printf("static const struct Placement placements[] = {\n");
+	for(short i=0; i<NPIECES; ++i) {
+		first_placement_of_piece[i] = n;
+		for(short row=0; row<HEIGHT; ++row) {
+			first[i*HEIGHT + row] = n;
+			printf("\t// %s, row %d\n", shapes[i].name, row);
+			for(short rotation=0; rotation<4; ++rotation) {
+				for(short v=0; v<2; ++v) {
+					struct Orientation const* o = &orientations[i][4*v + rotation];
+					if(o->distinct == 0 || row + o->height > HEIGHT) continue;
+					for(short x=0; x<=WIDTH-o->width; ++x) {
+						placement_masks[n] = o->mask << (WIDTH*row + x);
+						placement_pieces[n] = i;
+						printf("\t{0x%014llxULL, %d, %d},\n", (unsigned long long)placement_masks[n], 1000*(v+1) + 100*rotation + 10*row + x, i);
+						n += 1;
+					}
+				}
+			}
+		}
+	}
+	first[NPIECES*HEIGHT] = n;
+	first_placement_of_piece[NPIECES] = n;
+	printf("};\n\n");
+
+	printf("/**\n * Placements of piece i with the left upper corner in row y are placements[first_placement[i*BOARD_HEIGHT + y]]\n");
+	printf(" * up to (excluding) placements[first_placement[i*BOARD_HEIGHT + y + 1]].\n */\n");
+	printf("static const short first_placement[NPIECES*BOARD_HEIGHT + 1] = {");
+	for(short k=0; k<=NPIECES*HEIGHT; ++k) {
+		if(k%HEIGHT == 0) printf("\n\t");
+		else printf(" ");
+		printf("%d,", first[k]);
+	}
+	printf("\n};\n\n#define NPLACEMENTS %d\n\n", n);
+
+	/**
+	 * Placements by site: all placements covering a site, and all placements whose first site (lowest bit) is the site.
+	 */
+	int nplacements = n;
+	short const nsites = HEIGHT*WIDTH;
+
+	printf("/**\n * Placements covering site s (y*BOARD_WIDTH + x) are placements[covering_placements[k]] for k from first_covering[s]\n");
+	printf(" * up to (excluding) first_covering[s+1].\n */\n");
+	printf("static const short covering_placements[] = {");
+	n = 0;
+	for(short site=0; site<nsites; ++site) {
+		first[site] = n;
+		printf("\n\t");
+		for(int k=0; k<nplacements; ++k) {
+			if(placement_masks[k] & ((uint64_t)1 << site)) {
+				printf("%s%d,", (n == first[site]) ? "" : " ", k);
+				n += 1;
+			}
+		}
+	}
+	first[nsites] = n;
+	printf("\n};\n\nstatic const short first_covering[BOARD_HEIGHT*BOARD_WIDTH + 1] = {\n\t");
+	for(short site=0; site<=nsites; ++site) {
+		printf("%d,%s", first[site], (site == nsites) ? "" : (site%WIDTH == WIDTH-1) ? "\n\t" : " ");
+	}
+	printf("\n};\n\n");
+
+	printf("/**\n * Placements whose first site is s are placements[anchored_placements[k]] for k from first_anchored[s]\n");
+	printf(" * up to (excluding) first_anchored[s+1].\n */\n");
+	printf("static const short anchored_placements[] = {");
+	n = 0;
+	for(short site=0; site<nsites; ++site) {
+		first[site] = n;
+		printf("\n\t");
+		for(int k=0; k<nplacements; ++k) {
+			if(__builtin_ctzll(placement_masks[k]) == site) {
+				printf("%s%d,", (n == first[site]) ? "" : " ", k);
+				n += 1;
+			}
+		}
+	}
+	first[nsites] = n;
+	printf("\n};\n\nstatic const short first_anchored[BOARD_HEIGHT*BOARD_WIDTH + 1] = {\n\t");
+	for(short site=0; site<=nsites; ++site) {
+		printf("%d,%s", first[site], (site == nsites) ? "" : (site%WIDTH == WIDTH-1) ? "\n\t" : " ");
+	}
+	printf("\n};\n\n");
+
+	/**
+	 * Images of the placements under the symmetries of the board: mirroring on the vertical axis (x -> WIDTH-1-x), on the
+	 * horizontal axis (y -> HEIGHT-1-y) and rotation by 180 degrees (both).
+	 */
+	static short images[MAX_PLACEMENTS][3];
+	for(int k=0; k<nplacements; ++k) {
+		for(short s=0; s<3; ++s) {
+			uint64_t image = 0;
+			for(short site=0; site<nsites; ++site) {
+				if((placement_masks[k] & ((uint64_t)1 << site)) == 0) continue;
+				short y = site/WIDTH, x = site%WIDTH;
+				if(s != 1) x = WIDTH-1-x;
+				if(s != 0) y = HEIGHT-1-y;
+				image |= (uint64_t)1 << (WIDTH*y + x);
+			}
+			images[k][s] = -1;
+			for(int j=0; j<nplacements; ++j) {
+				if(placement_masks[j] == image && placement_pieces[j] == placement_pieces[k]) images[k][s] = j;
+			}
+		}
+	}
+
+	short symmetry_piece = -1;  // first piece none of whose placements is mapped onto itself by a symmetry;
+	for(short i=0; i<NPIECES && symmetry_piece < 0; ++i) {
+		symmetry_piece = i;
+		for(int k=first_placement_of_piece[i]; k<first_placement_of_piece[i+1]; ++k) {
+			if(images[k][0] == k || images[k][1] == k || images[k][2] == k) symmetry_piece = -1;
+		}
+	}
+
+	printf("/**\n * Images of placement k under the symmetries of the board: symmetric_placements[k][0]: mirrored on the vertical axis,\n");
+	printf(" * [1]: mirrored on the horizontal axis, [2]: rotated by 180 degrees.\n */\n");
+	printf("static const short symmetric_placements[NPLACEMENTS][3] = {\n");
+	for(int k=0; k<nplacements; ++k) {
+		printf("\t{%d, %d, %d},\n", images[k][0], images[k][1], images[k][2]);
+	}
+	printf("};\n\n");
+
+	printf("/**\n * No placement of this piece is mapped onto itself by a symmetry of the board, so each solution and its three images\n");
+	printf(" * are four different solutions that contain four different placements of this piece (-1: there is no such piece).\n */\n");
+	printf("#define SYMMETRY_PIECE %d\n\n", symmetry_piece);
+
+	printf("/**\n * The piece set: names, version A as rows of '#' and '.' separated by '/', and whether version B (mirrored on the\n");
+	printf(" * y-axis) has orientations that are no rotations of version A.\n */\n");
+	printf("static const char* const piece_names[NPIECES] = {");
+	for(short i=0; i<NPIECES; ++i) {
+		printf("%s\"%s\"", (i == 0) ? "" : ", ", shapes[i].name);
+	}
+	printf("};\n\nstatic const char* const piece_shapes[NPIECES] = {");
+	for(short i=0; i<NPIECES; ++i) {
+		printf("%s\"", (i == 0) ? "" : ", ");
+		for(short y=0; y<shapes[i].height; ++y) {
+			printf("%s%s", (y == 0) ? "" : "/", shapes[i].rows[y]);
+		}
+		printf("\"");
+	}
+	printf("};\n\nstatic const short piece_mirrored[NPIECES] = {");
+	for(short i=0; i<NPIECES; ++i) {
+		short mirrored = 0;
+		for(short rotation=0; rotation<4; ++rotation) {
+			mirrored |= orientations[i][4 + rotation].distinct;
+		}
+		printf("%s%d", (i == 0) ? "" : ", ", mirrored);
+	}
+	printf("};\n\n#endif // PLACEMENTS_H\n");
+
+	return 0;
+}
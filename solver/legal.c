@@ -0,0 +1,133 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LEGAL_X86
+#endif
+#include "solver.h"
+
+/**
+ * Tests a whole group of placements against the board at once. The masks of the placements are copied into a plain
+ * array, in which the placements of a piece starting in a row (all orientations and horizontal offsets, see
+ * first_placement) are contiguous: a vector of them is a single load, and the whole group is tested with a few ANDs
+ * and compares.
+ *
+ * iter_cells doesn't use it: most of its candidates belong to pieces that are already used, so testing all of them
+ * up front costs more than it saves.
+ */
+
+uint64_t placement_masks[NPLACEMENTS];  // placements[k].mask;
+uint64_t (*legal_placements)(uint64_t board, uint64_t const* masks, short n);
+
+
+static uint64_t legal_scalar(uint64_t board, uint64_t const* masks, short n) {
+
+	uint64_t legal = 0;
+	for(short k=0; k<n; ++k) {
+		legal |= (uint64_t)((masks[k] & board) == 0) << k;
+	}
+	return legal;
+}
+
+
+#ifdef LEGAL_X86
+__attribute__((target("sse4.1")))
+static uint64_t legal_sse(uint64_t board, uint64_t const* masks, short n) {
+
+	__m128i const b = _mm_set1_epi64x(board);
+	__m128i const zero = _mm_setzero_si128();
+	uint64_t legal = 0;
+	short k = 0;
+	for(; k+2<=n; k+=2) {  // two placements per compare;
+		__m128i const free = _mm_cmpeq_epi64(_mm_and_si128(_mm_loadu_si128((__m128i const*)(masks+k)), b), zero);
+		legal |= (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(free)) << k;
+	}
+	if(k < n) legal |= legal_scalar(board, masks+k, n-k) << k;  // remaining placements;
+	return legal;
+}
+
+
+__attribute__((target("avx2")))
+static uint64_t legal_avx2(uint64_t board, uint64_t const* masks, short n) {
+
+	__m256i const b = _mm256_set1_epi64x(board);
+	__m256i const zero = _mm256_setzero_si256();
+	uint64_t legal = 0;
+	short k = 0;
+	for(; k+4<=n; k+=4) {  // four placements per compare;
+		__m256i const free = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_loadu_si256((__m256i const*)(masks+k)), b), zero);
+		legal |= (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(free)) << k;
+	}
+	if(k < n) legal |= legal_scalar(board, masks+k, n-k) << k;  // remaining placements;
+	return legal;
+}
+#endif
+
+
+/**
+ * @return the largest number of placements of a piece whose enclosing rectangle starts in the same row; iter_rows
+ *         tests them at once, so it needs at most 64 (the bits of the result of legal_placements).
+ */
+short largest_placement_group() {
+
+	short largest = 0;
+	for(short group=0; group<NPIECES*BOARD_HEIGHT; ++group) {
+		short const n = first_placement[group+1] - first_placement[group];
+		largest = (n > largest) ? n : largest;
+	}
+	return largest;
+}
+
+
+/**
+ * Fills the mask arrays and selects the kernel of legal_placements. Must be called before iter_rows.
+ *
+ * @param kernel -- "scalar", "sse" or "avx2" to force a kernel, "auto" for the best one the processor supports.
+ *
+ * @return the name of the selected kernel, or NULL if the requested kernel isn't supported.
+ *
+ */
+char const* legal_init(char const* kernel) {
+
+	for(short k=0; k<NPLACEMENTS; ++k) {
+		placement_masks[k] = placements[k].mask;
+	}
+
+	short const automatic = strcmp(kernel, "auto") == 0;
+#ifdef LEGAL_X86
+	__builtin_cpu_init();
+	if((automatic || strcmp(kernel, "avx2") == 0) && __builtin_cpu_supports("avx2")) {
+		legal_placements = legal_avx2;
+		return "avx2";
+	}
+	if((automatic || strcmp(kernel, "sse") == 0) && __builtin_cpu_supports("sse4.1")) {
+		legal_placements = legal_sse;
+		return "sse";
+	}
+#endif
+	if(automatic || strcmp(kernel, "scalar") == 0) {
+		legal_placements = legal_scalar;
+		return "scalar";
+	}
+	return NULL;
+}
@@ -0,0 +1,162 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "parallel.h"
+
+struct Worker {
+	pthread_mutex_t lock;  // protects next and count;
+	int next;  // next task of this worker; the worker's tasks are next, next+nthreads, next+2*nthreads, ...;
+	int count;  // number of tasks left to this worker;
+	int id;
+	struct Pool* pool;
+	pthread_t thread;
+};
+
+struct Pool {
+	struct Worker* workers;
+	int nthreads;
+	void (*run)(int task, int worker, void* data);
+	void* data;
+};
+
+
+/**
+ * @return the number of online processor cores (at least 1).
+ */
+int parallel_ncores() {
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return (n > 0) ? (int)n : 1;
+}
+
+
+/**
+ * Takes the next task from the front of the worker's own range.
+ *
+ * @return index of the task, -1 if the range is empty.
+ */
+static int pop(struct Worker* worker) {
+
+	int task = -1;
+
+	pthread_mutex_lock(&worker->lock);
+	if(worker->count > 0) {
+		task = worker->next;
+		worker->next += worker->pool->nthreads;
+		worker->count -= 1;
+	}
+	pthread_mutex_unlock(&worker->lock);
+
+	return task;
+}
+
+
+/**
+ * Moves the back half of another worker's remaining tasks to the thief.
+ *
+ * @return 0 if tasks were stolen, -1 if all other workers are out of tasks.
+ */
+static int steal(struct Worker* thief) {
+
+	struct Pool* pool = thief->pool;
+
+	for(int i=1; i<pool->nthreads; ++i) {
+		struct Worker* victim = &pool->workers[(thief->id + i) % pool->nthreads];
+		int next = 0, count = 0;
+
+		pthread_mutex_lock(&victim->lock);
+		if(victim->count > 0) {
+			count = (victim->count + 1)/2;
+			victim->count -= count;
+			next = victim->next + victim->count*pool->nthreads;
+		}
+		pthread_mutex_unlock(&victim->lock);
+
+		if(count > 0) {
+			pthread_mutex_lock(&thief->lock);
+			thief->next = next;
+			thief->count = count;
+			pthread_mutex_unlock(&thief->lock);
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+
+static void* work(void* arg) {
+
+	struct Worker* worker = arg;
+	struct Pool* pool = worker->pool;
+
+	for(;;) {
+		int task = pop(worker);
+		if(task < 0) {
+			if(steal(worker) != 0) break;  // tasks are never added, so once everything is taken the worker is done;
+			continue;
+		}
+		pool->run(task, worker->id, pool->data);
+	}
+
+	return NULL;
+}
+
+
+/**
+ * Runs tasks 0 to ntasks-1 on a pool of threads and waits until all of them are done.
+ *
+ * @param ntasks -- number of tasks.
+ * @param nthreads -- number of worker threads.
+ * @param run -- called once for each task with the index of the task and of the worker (0 to nthreads-1) running it.
+ * @param data -- passed to run.
+ *
+ */
+void parallel_for(int ntasks, int nthreads, void (*run)(int task, int worker, void* data), void* data) {
+
+	struct Pool pool;
+	pool.nthreads = nthreads;
+	pool.run = run;
+	pool.data = data;
+	pool.workers = calloc(nthreads, sizeof *(pool.workers));
+
+	for(int w=0; w<nthreads; ++w) {
+		pthread_mutex_init(&pool.workers[w].lock, NULL);
+		pool.workers[w].next = w;
+		pool.workers[w].count = (ntasks > w) ? (ntasks - w + nthreads-1)/nthreads : 0;
+		pool.workers[w].id = w;
+		pool.workers[w].pool = &pool;
+	}
+
+	for(int w=1; w<nthreads; ++w) {
+		pthread_create(&pool.workers[w].thread, NULL, work, &pool.workers[w]);
+	}
+	work(&pool.workers[0]);  // the calling thread is worker 0;
+	for(int w=1; w<nthreads; ++w) {
+		pthread_join(pool.workers[w].thread, NULL);
+	}
+
+	for(int w=0; w<nthreads; ++w) {
+		pthread_mutex_destroy(&pool.workers[w].lock);
+	}
+	free(pool.workers);
+}
@@ -0,0 +1,35 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+/**
+ * Work-stealing thread pool for a fixed number of independent tasks.
+ *
+ * The tasks are dealt round-robin (worker w gets tasks w, w+nthreads, w+2*nthreads, ...) and every worker processes
+ * its tasks in increasing order, so all workers stay close to each other in the task order. A worker that ran out of
+ * tasks steals the back half of the remaining tasks of another worker.
+ */
+
+int parallel_ncores();
+void parallel_for(int ntasks, int nthreads, void (*run)(int task, int worker, void* data), void* data);
+
+#endif // PARALLEL_H
@@ -0,0 +1,3932 @@
+/* Generated by gen_placements.c -- do not edit. */
+
+#ifndef PLACEMENTS_H
+#define PLACEMENTS_H
+
+#include <stdint.h>
+
+#define NPIECES 12
+#define BOARD_HEIGHT 11
+#define BOARD_WIDTH 5
+#define PIECE_EXTENT 4  // maximum extent of a piece in either direction;
+#define PIECE_SIZE 5  // maximum number of sites of a piece;
+
+struct Placement {
+	uint64_t mask;  // sites occupied by the piece, see ROW_MASK;
+	int used;  // <version>*1000 + <rotation>*100 + <y>*10 + <x> (where <version> is 1 for A and 2 for B);
+	short piece;  // index of the piece;
+};
+
+static const struct Placement placements[] = {
+	// white, row 0
+	{0x00000000000061ULL, 1000, 0},
+	{0x000000000000c2ULL, 1001, 0},
+	{0x00000000000184ULL, 1002, 0},
+	{0x00000000000308ULL, 1003, 0},
+	{0x00000000000023ULL, 1100, 0},
+	{0x00000000000046ULL, 1101, 0},
+	{0x0000000000008cULL, 1102, 0},
+	{0x00000000000118ULL, 1103, 0},
+	{0x00000000000043ULL, 1200, 0},
+	{0x00000000000086ULL, 1201, 0},
+	{0x0000000000010cULL, 1202, 0},
+	{0x00000000000218ULL, 1203, 0},
+	{0x00000000000062ULL, 1300, 0},
+	{0x000000000000c4ULL, 1301, 0},
+	{0x00000000000188ULL, 1302, 0},
+	{0x00000000000310ULL, 1303, 0},
+	// white, row 1
+	{0x00000000000c20ULL, 1010, 0},
+	{0x00000000001840ULL, 1011, 0},
+	{0x00000000003080ULL, 1012, 0},
+	{0x00000000006100ULL, 1013, 0},
+	{0x00000000000460ULL, 1110, 0},
+	{0x000000000008c0ULL, 1111, 0},
+	{0x00000000001180ULL, 1112, 0},
+	{0x00000000002300ULL, 1113, 0},
+	{0x00000000000860ULL, 1210, 0},
+	{0x000000000010c0ULL, 1211, 0},
+	{0x00000000002180ULL, 1212, 0},
+	{0x00000000004300ULL, 1213, 0},
+	{0x00000000000c40ULL, 1310, 0},
+	{0x00000000001880ULL, 1311, 0},
+	{0x00000000003100ULL, 1312, 0},
+	{0x00000000006200ULL, 1313, 0},
+	// white, row 2
+	{0x00000000018400ULL, 1020, 0},
+	{0x00000000030800ULL, 1021, 0},
+	{0x00000000061000ULL, 1022, 0},
+	{0x000000000c2000ULL, 1023, 0},
+	{0x00000000008c00ULL, 1120, 0},
+	{0x00000000011800ULL, 1121, 0},
+	{0x00000000023000ULL, 1122, 0},
+	{0x00000000046000ULL, 1123, 0},
+	{0x00000000010c00ULL, 1220, 0},
+	{0x00000000021800ULL, 1221, 0},
+	{0x00000000043000ULL, 1222, 0},
+	{0x00000000086000ULL, 1223, 0},
+	{0x00000000018800ULL, 1320, 0},
+	{0x00000000031000ULL, 1321, 0},
+	{0x00000000062000ULL, 1322, 0},
+	{0x000000000c4000ULL, 1323, 0},
+	// white, row 3
+	{0x00000000308000ULL, 1030, 0},
+	{0x00000000610000ULL, 1031, 0},
+	{0x00000000c20000ULL, 1032, 0},
+	{0x00000001840000ULL, 1033, 0},
+	{0x00000000118000ULL, 1130, 0},
+	{0x00000000230000ULL, 1131, 0},
+	{0x00000000460000ULL, 1132, 0},
+	{0x000000008c0000ULL, 1133, 0},
+	{0x00000000218000ULL, 1230, 0},
+	{0x00000000430000ULL, 1231, 0},
+	{0x00000000860000ULL, 1232, 0},
+	{0x000000010c0000ULL, 1233, 0},
+	{0x00000000310000ULL, 1330, 0},
+	{0x00000000620000ULL, 1331, 0},
+	{0x00000000c40000ULL, 1332, 0},
+	{0x00000001880000ULL, 1333, 0},
+	// white, row 4
+	{0x00000006100000ULL, 1040, 0},
+	{0x0000000c200000ULL, 1041, 0},
+	{0x00000018400000ULL, 1042, 0},
+	{0x00000030800000ULL, 1043, 0},
+	{0x00000002300000ULL, 1140, 0},
+	{0x00000004600000ULL, 1141, 0},
+	{0x00000008c00000ULL, 1142, 0},
+	{0x00000011800000ULL, 1143, 0},
+	{0x00000004300000ULL, 1240, 0},
+	{0x00000008600000ULL, 1241, 0},
+	{0x00000010c00000ULL, 1242, 0},
+	{0x00000021800000ULL, 1243, 0},
+	{0x00000006200000ULL, 1340, 0},
+	{0x0000000c400000ULL, 1341, 0},
+	{0x00000018800000ULL, 1342, 0},
+	{0x00000031000000ULL, 1343, 0},
+	// white, row 5
+	{0x000000c2000000ULL, 1050, 0},
+	{0x00000184000000ULL, 1051, 0},
+	{0x00000308000000ULL, 1052, 0},
+	{0x00000610000000ULL, 1053, 0},
+	{0x00000046000000ULL, 1150, 0},
+	{0x0000008c000000ULL, 1151, 0},
+	{0x00000118000000ULL, 1152, 0},
+	{0x00000230000000ULL, 1153, 0},
+	{0x00000086000000ULL, 1250, 0},
+	{0x0000010c000000ULL, 1251, 0},
+	{0x00000218000000ULL, 1252, 0},
+	{0x00000430000000ULL, 1253, 0},
+	{0x000000c4000000ULL, 1350, 0},
+	{0x00000188000000ULL, 1351, 0},
+	{0x00000310000000ULL, 1352, 0},
+	{0x00000620000000ULL, 1353, 0},
+	// white, row 6
+	{0x00001840000000ULL, 1060, 0},
+	{0x00003080000000ULL, 1061, 0},
+	{0x00006100000000ULL, 1062, 0},
+	{0x0000c200000000ULL, 1063, 0},
+	{0x000008c0000000ULL, 1160, 0},
+	{0x00001180000000ULL, 1161, 0},
+	{0x00002300000000ULL, 1162, 0},
+	{0x00004600000000ULL, 1163, 0},
+	{0x000010c0000000ULL, 1260, 0},
+	{0x00002180000000ULL, 1261, 0},
+	{0x00004300000000ULL, 1262, 0},
+	{0x00008600000000ULL, 1263, 0},
+	{0x00001880000000ULL, 1360, 0},
+	{0x00003100000000ULL, 1361, 0},
+	{0x00006200000000ULL, 1362, 0},
+	{0x0000c400000000ULL, 1363, 0},
+	// white, row 7
+	{0x00030800000000ULL, 1070, 0},
+	{0x00061000000000ULL, 1071, 0},
+	{0x000c2000000000ULL, 1072, 0},
+	{0x00184000000000ULL, 1073, 0},
+	{0x00011800000000ULL, 1170, 0},
+	{0x00023000000000ULL, 1171, 0},
+	{0x00046000000000ULL, 1172, 0},
+	{0x0008c000000000ULL, 1173, 0},
+	{0x00021800000000ULL, 1270, 0},
+	{0x00043000000000ULL, 1271, 0},
+	{0x00086000000000ULL, 1272, 0},
+	{0x0010c000000000ULL, 1273, 0},
+	{0x00031000000000ULL, 1370, 0},
+	{0x00062000000000ULL, 1371, 0},
+	{0x000c4000000000ULL, 1372, 0},
+	{0x00188000000000ULL, 1373, 0},
+	// white, row 8
+	{0x00610000000000ULL, 1080, 0},
+	{0x00c20000000000ULL, 1081, 0},
+	{0x01840000000000ULL, 1082, 0},
+	{0x03080000000000ULL, 1083, 0},
+	{0x00230000000000ULL, 1180, 0},
+	{0x00460000000000ULL, 1181, 0},
+	{0x008c0000000000ULL, 1182, 0},
+	{0x01180000000000ULL, 1183, 0},
+	{0x00430000000000ULL, 1280, 0},
+	{0x00860000000000ULL, 1281, 0},
+	{0x010c0000000000ULL, 1282, 0},
+	{0x02180000000000ULL, 1283, 0},
+	{0x00620000000000ULL, 1380, 0},
+	{0x00c40000000000ULL, 1381, 0},
+	{0x01880000000000ULL, 1382, 0},
+	{0x03100000000000ULL, 1383, 0},
+	// white, row 9
+	{0x0c200000000000ULL, 1090, 0},
+	{0x18400000000000ULL, 1091, 0},
+	{0x30800000000000ULL, 1092, 0},
+	{0x61000000000000ULL, 1093, 0},
+	{0x04600000000000ULL, 1190, 0},
+	{0x08c00000000000ULL, 1191, 0},
+	{0x11800000000000ULL, 1192, 0},
+	{0x23000000000000ULL, 1193, 0},
+	{0x08600000000000ULL, 1290, 0},
+	{0x10c00000000000ULL, 1291, 0},
+	{0x21800000000000ULL, 1292, 0},
+	{0x43000000000000ULL, 1293, 0},
+	{0x0c400000000000ULL, 1390, 0},
+	{0x18800000000000ULL, 1391, 0},
+	{0x31000000000000ULL, 1392, 0},
+	{0x62000000000000ULL, 1393, 0},
+	// white, row 10
+	// lightgreen, row 0
+	{0x00000000000063ULL, 1000, 1},
+	{0x000000000000c6ULL, 1001, 1},
+	{0x0000000000018cULL, 1002, 1},
+	{0x00000000000318ULL, 1003, 1},
+	// lightgreen, row 1
+	{0x00000000000c60ULL, 1010, 1},
+	{0x000000000018c0ULL, 1011, 1},
+	{0x00000000003180ULL, 1012, 1},
+	{0x00000000006300ULL, 1013, 1},
+	// lightgreen, row 2
+	{0x00000000018c00ULL, 1020, 1},
+	{0x00000000031800ULL, 1021, 1},
+	{0x00000000063000ULL, 1022, 1},
+	{0x000000000c6000ULL, 1023, 1},
+	// lightgreen, row 3
+	{0x00000000318000ULL, 1030, 1},
+	{0x00000000630000ULL, 1031, 1},
+	{0x00000000c60000ULL, 1032, 1},
+	{0x000000018c0000ULL, 1033, 1},
+	// lightgreen, row 4
+	{0x00000006300000ULL, 1040, 1},
+	{0x0000000c600000ULL, 1041, 1},
+	{0x00000018c00000ULL, 1042, 1},
+	{0x00000031800000ULL, 1043, 1},
+	// lightgreen, row 5
+	{0x000000c6000000ULL, 1050, 1},
+	{0x0000018c000000ULL, 1051, 1},
+	{0x00000318000000ULL, 1052, 1},
+	{0x00000630000000ULL, 1053, 1},
+	// lightgreen, row 6
+	{0x000018c0000000ULL, 1060, 1},
+	{0x00003180000000ULL, 1061, 1},
+	{0x00006300000000ULL, 1062, 1},
+	{0x0000c600000000ULL, 1063, 1},
+	// lightgreen, row 7
+	{0x00031800000000ULL, 1070, 1},
+	{0x00063000000000ULL, 1071, 1},
+	{0x000c6000000000ULL, 1072, 1},
+	{0x0018c000000000ULL, 1073, 1},
+	// lightgreen, row 8
+	{0x00630000000000ULL, 1080, 1},
+	{0x00c60000000000ULL, 1081, 1},
+	{0x018c0000000000ULL, 1082, 1},
+	{0x03180000000000ULL, 1083, 1},
+	// lightgreen, row 9
+	{0x0c600000000000ULL, 1090, 1},
+	{0x18c00000000000ULL, 1091, 1},
+	{0x31800000000000ULL, 1092, 1},
+	{0x63000000000000ULL, 1093, 1},
+	// lightgreen, row 10
+	// orange, row 0
+	{0x00000000000c21ULL, 1000, 2},
+	{0x00000000001842ULL, 1001, 2},
+	{0x00000000003084ULL, 1002, 2},
+	{0x00000000006108ULL, 1003, 2},
+	{0x00000000000c42ULL, 2000, 2},
+	{0x00000000001884ULL, 2001, 2},
+	{0x00000000003108ULL, 2002, 2},
+	{0x00000000006210ULL, 2003, 2},
+	{0x00000000000027ULL, 1100, 2},
+	{0x0000000000004eULL, 1101, 2},
+	{0x0000000000009cULL, 1102, 2},
+	{0x000000000000e1ULL, 2100, 2},
+	{0x000000000001c2ULL, 2101, 2},
+	{0x00000000000384ULL, 2102, 2},
+	{0x00000000000843ULL, 1200, 2},
+	{0x00000000001086ULL, 1201, 2},
+	{0x0000000000210cULL, 1202, 2},
+	{0x00000000004218ULL, 1203, 2},
+	{0x00000000000423ULL, 2200, 2},
+	{0x00000000000846ULL, 2201, 2},
+	{0x0000000000108cULL, 2202, 2},
+	{0x00000000002118ULL, 2203, 2},
+	{0x000000000000e4ULL, 1300, 2},
+	{0x000000000001c8ULL, 1301, 2},
+	{0x00000000000390ULL, 1302, 2},
+	{0x00000000000087ULL, 2300, 2},
+	{0x0000000000010eULL, 2301, 2},
+	{0x0000000000021cULL, 2302, 2},
+	// orange, row 1
+	{0x00000000018420ULL, 1010, 2},
+	{0x00000000030840ULL, 1011, 2},
+	{0x00000000061080ULL, 1012, 2},
+	{0x000000000c2100ULL, 1013, 2},
+	{0x00000000018840ULL, 2010, 2},
+	{0x00000000031080ULL, 2011, 2},
+	{0x00000000062100ULL, 2012, 2},
+	{0x000000000c4200ULL, 2013, 2},
+	{0x000000000004e0ULL, 1110, 2},
+	{0x000000000009c0ULL, 1111, 2},
+	{0x00000000001380ULL, 1112, 2},
+	{0x00000000001c20ULL, 2110, 2},
+	{0x00000000003840ULL, 2111, 2},
+	{0x00000000007080ULL, 2112, 2},
+	{0x00000000010860ULL, 1210, 2},
+	{0x000000000210c0ULL, 1211, 2},
+	{0x00000000042180ULL, 1212, 2},
+	{0x00000000084300ULL, 1213, 2},
+	{0x00000000008460ULL, 2210, 2},
+	{0x000000000108c0ULL, 2211, 2},
+	{0x00000000021180ULL, 2212, 2},
+	{0x00000000042300ULL, 2213, 2},
+	{0x00000000001c80ULL, 1310, 2},
+	{0x00000000003900ULL, 1311, 2},
+	{0x00000000007200ULL, 1312, 2},
+	{0x000000000010e0ULL, 2310, 2},
+	{0x000000000021c0ULL, 2311, 2},
+	{0x00000000004380ULL, 2312, 2},
+	// orange, row 2
+	{0x00000000308400ULL, 1020, 2},
+	{0x00000000610800ULL, 1021, 2},
+	{0x00000000c21000ULL, 1022, 2},
+	{0x00000001842000ULL, 1023, 2},
+	{0x00000000310800ULL, 2020, 2},
+	{0x00000000621000ULL, 2021, 2},
+	{0x00000000c42000ULL, 2022, 2},
+	{0x00000001884000ULL, 2023, 2},
+	{0x00000000009c00ULL, 1120, 2},
+	{0x00000000013800ULL, 1121, 2},
+	{0x00000000027000ULL, 1122, 2},
+	{0x00000000038400ULL, 2120, 2},
+	{0x00000000070800ULL, 2121, 2},
+	{0x000000000e1000ULL, 2122, 2},
+	{0x00000000210c00ULL, 1220, 2},
+	{0x00000000421800ULL, 1221, 2},
+	{0x00000000843000ULL, 1222, 2},
+	{0x00000001086000ULL, 1223, 2},
+	{0x00000000108c00ULL, 2220, 2},
+	{0x00000000211800ULL, 2221, 2},
+	{0x00000000423000ULL, 2222, 2},
+	{0x00000000846000ULL, 2223, 2},
+	{0x00000000039000ULL, 1320, 2},
+	{0x00000000072000ULL, 1321, 2},
+	{0x000000000e4000ULL, 1322, 2},
+	{0x00000000021c00ULL, 2320, 2},
+	{0x00000000043800ULL, 2321, 2},
+	{0x00000000087000ULL, 2322, 2},
+	// orange, row 3
+	{0x00000006108000ULL, 1030, 2},
+	{0x0000000c210000ULL, 1031, 2},
+	{0x00000018420000ULL, 1032, 2},
+	{0x00000030840000ULL, 1033, 2},
+	{0x00000006210000ULL, 2030, 2},
+	{0x0000000c420000ULL, 2031, 2},
+	{0x00000018840000ULL, 2032, 2},
+	{0x00000031080000ULL, 2033, 2},
+	{0x00000000138000ULL, 1130, 2},
+	{0x00000000270000ULL, 1131, 2},
+	{0x000000004e0000ULL, 1132, 2},
+	{0x00000000708000ULL, 2130, 2},
+	{0x00000000e10000ULL, 2131, 2},
+	{0x00000001c20000ULL, 2132, 2},
+	{0x00000004218000ULL, 1230, 2},
+	{0x00000008430000ULL, 1231, 2},
+	{0x00000010860000ULL, 1232, 2},
+	{0x000000210c0000ULL, 1233, 2},
+	{0x00000002118000ULL, 2230, 2},
+	{0x00000004230000ULL, 2231, 2},
+	{0x00000008460000ULL, 2232, 2},
+	{0x000000108c0000ULL, 2233, 2},
+	{0x00000000720000ULL, 1330, 2},
+	{0x00000000e40000ULL, 1331, 2},
+	{0x00000001c80000ULL, 1332, 2},
+	{0x00000000438000ULL, 2330, 2},
+	{0x00000000870000ULL, 2331, 2},
+	{0x000000010e0000ULL, 2332, 2},
+	// orange, row 4
+	{0x000000c2100000ULL, 1040, 2},
+	{0x00000184200000ULL, 1041, 2},
+	{0x00000308400000ULL, 1042, 2},
+	{0x00000610800000ULL, 1043, 2},
+	{0x000000c4200000ULL, 2040, 2},
+	{0x00000188400000ULL, 2041, 2},
+	{0x00000310800000ULL, 2042, 2},
+	{0x00000621000000ULL, 2043, 2},
+	{0x00000002700000ULL, 1140, 2},
+	{0x00000004e00000ULL, 1141, 2},
+	{0x00000009c00000ULL, 1142, 2},
+	{0x0000000e100000ULL, 2140, 2},
+	{0x0000001c200000ULL, 2141, 2},
+	{0x00000038400000ULL, 2142, 2},
+	{0x00000084300000ULL, 1240, 2},
+	{0x00000108600000ULL, 1241, 2},
+	{0x00000210c00000ULL, 1242, 2},
+	{0x00000421800000ULL, 1243, 2},
+	{0x00000042300000ULL, 2240, 2},
+	{0x00000084600000ULL, 2241, 2},
+	{0x00000108c00000ULL, 2242, 2},
+	{0x00000211800000ULL, 2243, 2},
+	{0x0000000e400000ULL, 1340, 2},
+	{0x0000001c800000ULL, 1341, 2},
+	{0x00000039000000ULL, 1342, 2},
+	{0x00000008700000ULL, 2340, 2},
+	{0x00000010e00000ULL, 2341, 2},
+	{0x00000021c00000ULL, 2342, 2},
+	// orange, row 5
+	{0x00001842000000ULL, 1050, 2},
+	{0x00003084000000ULL, 1051, 2},
+	{0x00006108000000ULL, 1052, 2},
+	{0x0000c210000000ULL, 1053, 2},
+	{0x00001884000000ULL, 2050, 2},
+	{0x00003108000000ULL, 2051, 2},
+	{0x00006210000000ULL, 2052, 2},
+	{0x0000c420000000ULL, 2053, 2},
+	{0x0000004e000000ULL, 1150, 2},
+	{0x0000009c000000ULL, 1151, 2},
+	{0x00000138000000ULL, 1152, 2},
+	{0x000001c2000000ULL, 2150, 2},
+	{0x00000384000000ULL, 2151, 2},
+	{0x00000708000000ULL, 2152, 2},
+	{0x00001086000000ULL, 1250, 2},
+	{0x0000210c000000ULL, 1251, 2},
+	{0x00004218000000ULL, 1252, 2},
+	{0x00008430000000ULL, 1253, 2},
+	{0x00000846000000ULL, 2250, 2},
+	{0x0000108c000000ULL, 2251, 2},
+	{0x00002118000000ULL, 2252, 2},
+	{0x00004230000000ULL, 2253, 2},
+	{0x000001c8000000ULL, 1350, 2},
+	{0x00000390000000ULL, 1351, 2},
+	{0x00000720000000ULL, 1352, 2},
+	{0x0000010e000000ULL, 2350, 2},
+	{0x0000021c000000ULL, 2351, 2},
+	{0x00000438000000ULL, 2352, 2},
+	// orange, row 6
+	{0x00030840000000ULL, 1060, 2},
+	{0x00061080000000ULL, 1061, 2},
+	{0x000c2100000000ULL, 1062, 2},
+	{0x00184200000000ULL, 1063, 2},
+	{0x00031080000000ULL, 2060, 2},
+	{0x00062100000000ULL, 2061, 2},
+	{0x000c4200000000ULL, 2062, 2},
+	{0x00188400000000ULL, 2063, 2},
+	{0x000009c0000000ULL, 1160, 2},
+	{0x00001380000000ULL, 1161, 2},
+	{0x00002700000000ULL, 1162, 2},
+	{0x00003840000000ULL, 2160, 2},
+	{0x00007080000000ULL, 2161, 2},
+	{0x0000e100000000ULL, 2162, 2},
+	{0x000210c0000000ULL, 1260, 2},
+	{0x00042180000000ULL, 1261, 2},
+	{0x00084300000000ULL, 1262, 2},
+	{0x00108600000000ULL, 1263, 2},
+	{0x000108c0000000ULL, 2260, 2},
+	{0x00021180000000ULL, 2261, 2},
+	{0x00042300000000ULL, 2262, 2},
+	{0x00084600000000ULL, 2263, 2},
+	{0x00003900000000ULL, 1360, 2},
+	{0x00007200000000ULL, 1361, 2},
+	{0x0000e400000000ULL, 1362, 2},
+	{0x000021c0000000ULL, 2360, 2},
+	{0x00004380000000ULL, 2361, 2},
+	{0x00008700000000ULL, 2362, 2},
+	// orange, row 7
+	{0x00610800000000ULL, 1070, 2},
+	{0x00c21000000000ULL, 1071, 2},
+	{0x01842000000000ULL, 1072, 2},
+	{0x03084000000000ULL, 1073, 2},
+	{0x00621000000000ULL, 2070, 2},
+	{0x00c42000000000ULL, 2071, 2},
+	{0x01884000000000ULL, 2072, 2},
+	{0x03108000000000ULL, 2073, 2},
+	{0x00013800000000ULL, 1170, 2},
+	{0x00027000000000ULL, 1171, 2},
+	{0x0004e000000000ULL, 1172, 2},
+	{0x00070800000000ULL, 2170, 2},
+	{0x000e1000000000ULL, 2171, 2},
+	{0x001c2000000000ULL, 2172, 2},
+	{0x00421800000000ULL, 1270, 2},
+	{0x00843000000000ULL, 1271, 2},
+	{0x01086000000000ULL, 1272, 2},
+	{0x0210c000000000ULL, 1273, 2},
+	{0x00211800000000ULL, 2270, 2},
+	{0x00423000000000ULL, 2271, 2},
+	{0x00846000000000ULL, 2272, 2},
+	{0x0108c000000000ULL, 2273, 2},
+	{0x00072000000000ULL, 1370, 2},
+	{0x000e4000000000ULL, 1371, 2},
+	{0x001c8000000000ULL, 1372, 2},
+	{0x00043800000000ULL, 2370, 2},
+	{0x00087000000000ULL, 2371, 2},
+	{0x0010e000000000ULL, 2372, 2},
+	// orange, row 8
+	{0x0c210000000000ULL, 1080, 2},
+	{0x18420000000000ULL, 1081, 2},
+	{0x30840000000000ULL, 1082, 2},
+	{0x61080000000000ULL, 1083, 2},
+	{0x0c420000000000ULL, 2080, 2},
+	{0x18840000000000ULL, 2081, 2},
+	{0x31080000000000ULL, 2082, 2},
+	{0x62100000000000ULL, 2083, 2},
+	{0x00270000000000ULL, 1180, 2},
+	{0x004e0000000000ULL, 1181, 2},
+	{0x009c0000000000ULL, 1182, 2},
+	{0x00e10000000000ULL, 2180, 2},
+	{0x01c20000000000ULL, 2181, 2},
+	{0x03840000000000ULL, 2182, 2},
+	{0x08430000000000ULL, 1280, 2},
+	{0x10860000000000ULL, 1281, 2},
+	{0x210c0000000000ULL, 1282, 2},
+	{0x42180000000000ULL, 1283, 2},
+	{0x04230000000000ULL, 2280, 2},
+	{0x08460000000000ULL, 2281, 2},
+	{0x108c0000000000ULL, 2282, 2},
+	{0x21180000000000ULL, 2283, 2},
+	{0x00e40000000000ULL, 1380, 2},
+	{0x01c80000000000ULL, 1381, 2},
+	{0x03900000000000ULL, 1382, 2},
+	{0x00870000000000ULL, 2380, 2},
+	{0x010e0000000000ULL, 2381, 2},
+	{0x021c0000000000ULL, 2382, 2},
+	// orange, row 9
+	{0x04e00000000000ULL, 1190, 2},
+	{0x09c00000000000ULL, 1191, 2},
+	{0x13800000000000ULL, 1192, 2},
+	{0x1c200000000000ULL, 2190, 2},
+	{0x38400000000000ULL, 2191, 2},
+	{0x70800000000000ULL, 2192, 2},
+	{0x1c800000000000ULL, 1390, 2},
+	{0x39000000000000ULL, 1391, 2},
+	{0x72000000000000ULL, 1392, 2},
+	{0x10e00000000000ULL, 2390, 2},
+	{0x21c00000000000ULL, 2391, 2},
+	{0x43800000000000ULL, 2392, 2},
+	// orange, row 10
+	// darkblue, row 0
+	{0x00000000008421ULL, 1000, 3},
+	{0x00000000010842ULL, 1001, 3},
+	{0x00000000021084ULL, 1002, 3},
+	{0x00000000042108ULL, 1003, 3},
+	{0x00000000084210ULL, 1004, 3},
+	{0x0000000000000fULL, 1100, 3},
+	{0x0000000000001eULL, 1101, 3},
+	// darkblue, row 1
+	{0x00000000108420ULL, 1010, 3},
+	{0x00000000210840ULL, 1011, 3},
+	{0x00000000421080ULL, 1012, 3},
+	{0x00000000842100ULL, 1013, 3},
+	{0x00000001084200ULL, 1014, 3},
+	{0x000000000001e0ULL, 1110, 3},
+	{0x000000000003c0ULL, 1111, 3},
+	// darkblue, row 2
+	{0x00000002108400ULL, 1020, 3},
+	{0x00000004210800ULL, 1021, 3},
+	{0x00000008421000ULL, 1022, 3},
+	{0x00000010842000ULL, 1023, 3},
+	{0x00000021084000ULL, 1024, 3},
+	{0x00000000003c00ULL, 1120, 3},
+	{0x00000000007800ULL, 1121, 3},
+	// darkblue, row 3
+	{0x00000042108000ULL, 1030, 3},
+	{0x00000084210000ULL, 1031, 3},
+	{0x00000108420000ULL, 1032, 3},
+	{0x00000210840000ULL, 1033, 3},
+	{0x00000421080000ULL, 1034, 3},
+	{0x00000000078000ULL, 1130, 3},
+	{0x000000000f0000ULL, 1131, 3},
+	// darkblue, row 4
+	{0x00000842100000ULL, 1040, 3},
+	{0x00001084200000ULL, 1041, 3},
+	{0x00002108400000ULL, 1042, 3},
+	{0x00004210800000ULL, 1043, 3},
+	{0x00008421000000ULL, 1044, 3},
+	{0x00000000f00000ULL, 1140, 3},
+	{0x00000001e00000ULL, 1141, 3},
+	// darkblue, row 5
+	{0x00010842000000ULL, 1050, 3},
+	{0x00021084000000ULL, 1051, 3},
+	{0x00042108000000ULL, 1052, 3},
+	{0x00084210000000ULL, 1053, 3},
+	{0x00108420000000ULL, 1054, 3},
+	{0x0000001e000000ULL, 1150, 3},
+	{0x0000003c000000ULL, 1151, 3},
+	// darkblue, row 6
+	{0x00210840000000ULL, 1060, 3},
+	{0x00421080000000ULL, 1061, 3},
+	{0x00842100000000ULL, 1062, 3},
+	{0x01084200000000ULL, 1063, 3},
+	{0x02108400000000ULL, 1064, 3},
+	{0x000003c0000000ULL, 1160, 3},
+	{0x00000780000000ULL, 1161, 3},
+	// darkblue, row 7
+	{0x04210800000000ULL, 1070, 3},
+	{0x08421000000000ULL, 1071, 3},
+	{0x10842000000000ULL, 1072, 3},
+	{0x21084000000000ULL, 1073, 3},
+	{0x42108000000000ULL, 1074, 3},
+	{0x00007800000000ULL, 1170, 3},
+	{0x0000f000000000ULL, 1171, 3},
+	// darkblue, row 8
+	{0x000f0000000000ULL, 1180, 3},
+	{0x001e0000000000ULL, 1181, 3},
+	// darkblue, row 9
+	{0x01e00000000000ULL, 1190, 3},
+	{0x03c00000000000ULL, 1191, 3},
+	// darkblue, row 10
+	{0x3c000000000000ULL, 1200, 3},
+	{0x78000000000000ULL, 1201, 3},
+	// grey, row 0
+	{0x000000000008e2ULL, 1000, 4},
+	{0x000000000011c4ULL, 1001, 4},
+	{0x00000000002388ULL, 1002, 4},
+	// grey, row 1
+	{0x00000000011c40ULL, 1010, 4},
+	{0x00000000023880ULL, 1011, 4},
+	{0x00000000047100ULL, 1012, 4},
+	// grey, row 2
+	{0x00000000238800ULL, 1020, 4},
+	{0x00000000471000ULL, 1021, 4},
+	{0x000000008e2000ULL, 1022, 4},
+	// grey, row 3
+	{0x00000004710000ULL, 1030, 4},
+	{0x00000008e20000ULL, 1031, 4},
+	{0x00000011c40000ULL, 1032, 4},
+	// grey, row 4
+	{0x0000008e200000ULL, 1040, 4},
+	{0x0000011c400000ULL, 1041, 4},
+	{0x00000238800000ULL, 1042, 4},
+	// grey, row 5
+	{0x000011c4000000ULL, 1050, 4},
+	{0x00002388000000ULL, 1051, 4},
+	{0x00004710000000ULL, 1052, 4},
+	// grey, row 6
+	{0x00023880000000ULL, 1060, 4},
+	{0x00047100000000ULL, 1061, 4},
+	{0x0008e200000000ULL, 1062, 4},
+	// grey, row 7
+	{0x00471000000000ULL, 1070, 4},
+	{0x008e2000000000ULL, 1071, 4},
+	{0x011c4000000000ULL, 1072, 4},
+	// grey, row 8
+	{0x08e20000000000ULL, 1080, 4},
+	{0x11c40000000000ULL, 1081, 4},
+	{0x23880000000000ULL, 1082, 4},
+	// grey, row 9
+	// grey, row 10
+	// red, row 0
+	{0x00000000000c61ULL, 1000, 5},
+	{0x000000000018c2ULL, 1001, 5},
+	{0x00000000003184ULL, 1002, 5},
+	{0x00000000006308ULL, 1003, 5},
+	{0x00000000000c62ULL, 2000, 5},
+	{0x000000000018c4ULL, 2001, 5},
+	{0x00000000003188ULL, 2002, 5},
+	{0x00000000006310ULL, 2003, 5},
+	{0x00000000000067ULL, 1100, 5},
+	{0x000000000000ceULL, 1101, 5},
+	{0x0000000000019cULL, 1102, 5},
+	{0x000000000000e3ULL, 2100, 5},
+	{0x000000000001c6ULL, 2101, 5},
+	{0x0000000000038cULL, 2102, 5},
+	{0x00000000000863ULL, 1200, 5},
+	{0x000000000010c6ULL, 1201, 5},
+	{0x0000000000218cULL, 1202, 5},
+	{0x00000000004318ULL, 1203, 5},
+	{0x00000000000463ULL, 2200, 5},
+	{0x000000000008c6ULL, 2201, 5},
+	{0x0000000000118cULL, 2202, 5},
+	{0x00000000002318ULL, 2203, 5},
+	{0x000000000000e6ULL, 1300, 5},
+	{0x000000000001ccULL, 1301, 5},
+	{0x00000000000398ULL, 1302, 5},
+	{0x000000000000c7ULL, 2300, 5},
+	{0x0000000000018eULL, 2301, 5},
+	{0x0000000000031cULL, 2302, 5},
+	// red, row 1
+	{0x00000000018c20ULL, 1010, 5},
+	{0x00000000031840ULL, 1011, 5},
+	{0x00000000063080ULL, 1012, 5},
+	{0x000000000c6100ULL, 1013, 5},
+	{0x00000000018c40ULL, 2010, 5},
+	{0x00000000031880ULL, 2011, 5},
+	{0x00000000063100ULL, 2012, 5},
+	{0x000000000c6200ULL, 2013, 5},
+	{0x00000000000ce0ULL, 1110, 5},
+	{0x000000000019c0ULL, 1111, 5},
+	{0x00000000003380ULL, 1112, 5},
+	{0x00000000001c60ULL, 2110, 5},
+	{0x000000000038c0ULL, 2111, 5},
+	{0x00000000007180ULL, 2112, 5},
+	{0x00000000010c60ULL, 1210, 5},
+	{0x000000000218c0ULL, 1211, 5},
+	{0x00000000043180ULL, 1212, 5},
+	{0x00000000086300ULL, 1213, 5},
+	{0x00000000008c60ULL, 2210, 5},
+	{0x000000000118c0ULL, 2211, 5},
+	{0x00000000023180ULL, 2212, 5},
+	{0x00000000046300ULL, 2213, 5},
+	{0x00000000001cc0ULL, 1310, 5},
+	{0x00000000003980ULL, 1311, 5},
+	{0x00000000007300ULL, 1312, 5},
+	{0x000000000018e0ULL, 2310, 5},
+	{0x000000000031c0ULL, 2311, 5},
+	{0x00000000006380ULL, 2312, 5},
+	// red, row 2
+	{0x00000000318400ULL, 1020, 5},
+	{0x00000000630800ULL, 1021, 5},
+	{0x00000000c61000ULL, 1022, 5},
+	{0x000000018c2000ULL, 1023, 5},
+	{0x00000000318800ULL, 2020, 5},
+	{0x00000000631000ULL, 2021, 5},
+	{0x00000000c62000ULL, 2022, 5},
+	{0x000000018c4000ULL, 2023, 5},
+	{0x00000000019c00ULL, 1120, 5},
+	{0x00000000033800ULL, 1121, 5},
+	{0x00000000067000ULL, 1122, 5},
+	{0x00000000038c00ULL, 2120, 5},
+	{0x00000000071800ULL, 2121, 5},
+	{0x000000000e3000ULL, 2122, 5},
+	{0x00000000218c00ULL, 1220, 5},
+	{0x00000000431800ULL, 1221, 5},
+	{0x00000000863000ULL, 1222, 5},
+	{0x000000010c6000ULL, 1223, 5},
+	{0x00000000118c00ULL, 2220, 5},
+	{0x00000000231800ULL, 2221, 5},
+	{0x00000000463000ULL, 2222, 5},
+	{0x000000008c6000ULL, 2223, 5},
+	{0x00000000039800ULL, 1320, 5},
+	{0x00000000073000ULL, 1321, 5},
+	{0x000000000e6000ULL, 1322, 5},
+	{0x00000000031c00ULL, 2320, 5},
+	{0x00000000063800ULL, 2321, 5},
+	{0x000000000c7000ULL, 2322, 5},
+	// red, row 3
+	{0x00000006308000ULL, 1030, 5},
+	{0x0000000c610000ULL, 1031, 5},
+	{0x00000018c20000ULL, 1032, 5},
+	{0x00000031840000ULL, 1033, 5},
+	{0x00000006310000ULL, 2030, 5},
+	{0x0000000c620000ULL, 2031, 5},
+	{0x00000018c40000ULL, 2032, 5},
+	{0x00000031880000ULL, 2033, 5},
+	{0x00000000338000ULL, 1130, 5},
+	{0x00000000670000ULL, 1131, 5},
+	{0x00000000ce0000ULL, 1132, 5},
+	{0x00000000718000ULL, 2130, 5},
+	{0x00000000e30000ULL, 2131, 5},
+	{0x00000001c60000ULL, 2132, 5},
+	{0x00000004318000ULL, 1230, 5},
+	{0x00000008630000ULL, 1231, 5},
+	{0x00000010c60000ULL, 1232, 5},
+	{0x000000218c0000ULL, 1233, 5},
+	{0x00000002318000ULL, 2230, 5},
+	{0x00000004630000ULL, 2231, 5},
+	{0x00000008c60000ULL, 2232, 5},
+	{0x000000118c0000ULL, 2233, 5},
+	{0x00000000730000ULL, 1330, 5},
+	{0x00000000e60000ULL, 1331, 5},
+	{0x00000001cc0000ULL, 1332, 5},
+	{0x00000000638000ULL, 2330, 5},
+	{0x00000000c70000ULL, 2331, 5},
+	{0x000000018e0000ULL, 2332, 5},
+	// red, row 4
+	{0x000000c6100000ULL, 1040, 5},
+	{0x0000018c200000ULL, 1041, 5},
+	{0x00000318400000ULL, 1042, 5},
+	{0x00000630800000ULL, 1043, 5},
+	{0x000000c6200000ULL, 2040, 5},
+	{0x0000018c400000ULL, 2041, 5},
+	{0x00000318800000ULL, 2042, 5},
+	{0x00000631000000ULL, 2043, 5},
+	{0x00000006700000ULL, 1140, 5},
+	{0x0000000ce00000ULL, 1141, 5},
+	{0x00000019c00000ULL, 1142, 5},
+	{0x0000000e300000ULL, 2140, 5},
+	{0x0000001c600000ULL, 2141, 5},
+	{0x00000038c00000ULL, 2142, 5},
+	{0x00000086300000ULL, 1240, 5},
+	{0x0000010c600000ULL, 1241, 5},
+	{0x00000218c00000ULL, 1242, 5},
+	{0x00000431800000ULL, 1243, 5},
+	{0x00000046300000ULL, 2240, 5},
+	{0x0000008c600000ULL, 2241, 5},
+	{0x00000118c00000ULL, 2242, 5},
+	{0x00000231800000ULL, 2243, 5},
+	{0x0000000e600000ULL, 1340, 5},
+	{0x0000001cc00000ULL, 1341, 5},
+	{0x00000039800000ULL, 1342, 5},
+	{0x0000000c700000ULL, 2340, 5},
+	{0x00000018e00000ULL, 2341, 5},
+	{0x00000031c00000ULL, 2342, 5},
+	// red, row 5
+	{0x000018c2000000ULL, 1050, 5},
+	{0x00003184000000ULL, 1051, 5},
+	{0x00006308000000ULL, 1052, 5},
+	{0x0000c610000000ULL, 1053, 5},
+	{0x000018c4000000ULL, 2050, 5},
+	{0x00003188000000ULL, 2051, 5},
+	{0x00006310000000ULL, 2052, 5},
+	{0x0000c620000000ULL, 2053, 5},
+	{0x000000ce000000ULL, 1150, 5},
+	{0x0000019c000000ULL, 1151, 5},
+	{0x00000338000000ULL, 1152, 5},
+	{0x000001c6000000ULL, 2150, 5},
+	{0x0000038c000000ULL, 2151, 5},
+	{0x00000718000000ULL, 2152, 5},
+	{0x000010c6000000ULL, 1250, 5},
+	{0x0000218c000000ULL, 1251, 5},
+	{0x00004318000000ULL, 1252, 5},
+	{0x00008630000000ULL, 1253, 5},
+	{0x000008c6000000ULL, 2250, 5},
+	{0x0000118c000000ULL, 2251, 5},
+	{0x00002318000000ULL, 2252, 5},
+	{0x00004630000000ULL, 2253, 5},
+	{0x000001cc000000ULL, 1350, 5},
+	{0x00000398000000ULL, 1351, 5},
+	{0x00000730000000ULL, 1352, 5},
+	{0x0000018e000000ULL, 2350, 5},
+	{0x0000031c000000ULL, 2351, 5},
+	{0x00000638000000ULL, 2352, 5},
+	// red, row 6
+	{0x00031840000000ULL, 1060, 5},
+	{0x00063080000000ULL, 1061, 5},
+	{0x000c6100000000ULL, 1062, 5},
+	{0x0018c200000000ULL, 1063, 5},
+	{0x00031880000000ULL, 2060, 5},
+	{0x00063100000000ULL, 2061, 5},
+	{0x000c6200000000ULL, 2062, 5},
+	{0x0018c400000000ULL, 2063, 5},
+	{0x000019c0000000ULL, 1160, 5},
+	{0x00003380000000ULL, 1161, 5},
+	{0x00006700000000ULL, 1162, 5},
+	{0x000038c0000000ULL, 2160, 5},
+	{0x00007180000000ULL, 2161, 5},
+	{0x0000e300000000ULL, 2162, 5},
+	{0x000218c0000000ULL, 1260, 5},
+	{0x00043180000000ULL, 1261, 5},
+	{0x00086300000000ULL, 1262, 5},
+	{0x0010c600000000ULL, 1263, 5},
+	{0x000118c0000000ULL, 2260, 5},
+	{0x00023180000000ULL, 2261, 5},
+	{0x00046300000000ULL, 2262, 5},
+	{0x0008c600000000ULL, 2263, 5},
+	{0x00003980000000ULL, 1360, 5},
+	{0x00007300000000ULL, 1361, 5},
+	{0x0000e600000000ULL, 1362, 5},
+	{0x000031c0000000ULL, 2360, 5},
+	{0x00006380000000ULL, 2361, 5},
+	{0x0000c700000000ULL, 2362, 5},
+	// red, row 7
+	{0x00630800000000ULL, 1070, 5},
+	{0x00c61000000000ULL, 1071, 5},
+	{0x018c2000000000ULL, 1072, 5},
+	{0x03184000000000ULL, 1073, 5},
+	{0x00631000000000ULL, 2070, 5},
+	{0x00c62000000000ULL, 2071, 5},
+	{0x018c4000000000ULL, 2072, 5},
+	{0x03188000000000ULL, 2073, 5},
+	{0x00033800000000ULL, 1170, 5},
+	{0x00067000000000ULL, 1171, 5},
+	{0x000ce000000000ULL, 1172, 5},
+	{0x00071800000000ULL, 2170, 5},
+	{0x000e3000000000ULL, 2171, 5},
+	{0x001c6000000000ULL, 2172, 5},
+	{0x00431800000000ULL, 1270, 5},
+	{0x00863000000000ULL, 1271, 5},
+	{0x010c6000000000ULL, 1272, 5},
+	{0x0218c000000000ULL, 1273, 5},
+	{0x00231800000000ULL, 2270, 5},
+	{0x00463000000000ULL, 2271, 5},
+	{0x008c6000000000ULL, 2272, 5},
+	{0x0118c000000000ULL, 2273, 5},
+	{0x00073000000000ULL, 1370, 5},
+	{0x000e6000000000ULL, 1371, 5},
+	{0x001cc000000000ULL, 1372, 5},
+	{0x00063800000000ULL, 2370, 5},
+	{0x000c7000000000ULL, 2371, 5},
+	{0x0018e000000000ULL, 2372, 5},
+	// red, row 8
+	{0x0c610000000000ULL, 1080, 5},
+	{0x18c20000000000ULL, 1081, 5},
+	{0x31840000000000ULL, 1082, 5},
+	{0x63080000000000ULL, 1083, 5},
+	{0x0c620000000000ULL, 2080, 5},
+	{0x18c40000000000ULL, 2081, 5},
+	{0x31880000000000ULL, 2082, 5},
+	{0x63100000000000ULL, 2083, 5},
+	{0x00670000000000ULL, 1180, 5},
+	{0x00ce0000000000ULL, 1181, 5},
+	{0x019c0000000000ULL, 1182, 5},
+	{0x00e30000000000ULL, 2180, 5},
+	{0x01c60000000000ULL, 2181, 5},
+	{0x038c0000000000ULL, 2182, 5},
+	{0x08630000000000ULL, 1280, 5},
+	{0x10c60000000000ULL, 1281, 5},
+	{0x218c0000000000ULL, 1282, 5},
+	{0x43180000000000ULL, 1283, 5},
+	{0x04630000000000ULL, 2280, 5},
+	{0x08c60000000000ULL, 2281, 5},
+	{0x118c0000000000ULL, 2282, 5},
+	{0x23180000000000ULL, 2283, 5},
+	{0x00e60000000000ULL, 1380, 5},
+	{0x01cc0000000000ULL, 1381, 5},
+	{0x03980000000000ULL, 1382, 5},
+	{0x00c70000000000ULL, 2380, 5},
+	{0x018e0000000000ULL, 2381, 5},
+	{0x031c0000000000ULL, 2382, 5},
+	// red, row 9
+	{0x0ce00000000000ULL, 1190, 5},
+	{0x19c00000000000ULL, 1191, 5},
+	{0x33800000000000ULL, 1192, 5},
+	{0x1c600000000000ULL, 2190, 5},
+	{0x38c00000000000ULL, 2191, 5},
+	{0x71800000000000ULL, 2192, 5},
+	{0x1cc00000000000ULL, 1390, 5},
+	{0x39800000000000ULL, 1391, 5},
+	{0x73000000000000ULL, 1392, 5},
+	{0x18e00000000000ULL, 2390, 5},
+	{0x31c00000000000ULL, 2391, 5},
+	{0x63800000000000ULL, 2392, 5},
+	// red, row 10
+	// darkgreen, row 0
+	{0x00000000010861ULL, 1000, 6},
+	{0x000000000210c2ULL, 1001, 6},
+	{0x00000000042184ULL, 1002, 6},
+	{0x00000000084308ULL, 1003, 6},
+	{0x00000000008462ULL, 2000, 6},
+	{0x000000000108c4ULL, 2001, 6},
+	{0x00000000021188ULL, 2002, 6},
+	{0x00000000042310ULL, 2003, 6},
+	{0x000000000000ecULL, 1100, 6},
+	{0x000000000001d8ULL, 1101, 6},
+	{0x00000000000187ULL, 2100, 6},
+	{0x0000000000030eULL, 2101, 6},
+	{0x00000000010c21ULL, 1200, 6},
+	{0x00000000021842ULL, 1201, 6},
+	{0x00000000043084ULL, 1202, 6},
+	{0x00000000086108ULL, 1203, 6},
+	{0x00000000008c42ULL, 2200, 6},
+	{0x00000000011884ULL, 2201, 6},
+	{0x00000000023108ULL, 2202, 6},
+	{0x00000000046210ULL, 2203, 6},
+	{0x0000000000006eULL, 1300, 6},
+	{0x000000000000dcULL, 1301, 6},
+	{0x000000000001c3ULL, 2300, 6},
+	{0x00000000000386ULL, 2301, 6},
+	// darkgreen, row 1
+	{0x00000000210c20ULL, 1010, 6},
+	{0x00000000421840ULL, 1011, 6},
+	{0x00000000843080ULL, 1012, 6},
+	{0x00000001086100ULL, 1013, 6},
+	{0x00000000108c40ULL, 2010, 6},
+	{0x00000000211880ULL, 2011, 6},
+	{0x00000000423100ULL, 2012, 6},
+	{0x00000000846200ULL, 2013, 6},
+	{0x00000000001d80ULL, 1110, 6},
+	{0x00000000003b00ULL, 1111, 6},
+	{0x000000000030e0ULL, 2110, 6},
+	{0x000000000061c0ULL, 2111, 6},
+	{0x00000000218420ULL, 1210, 6},
+	{0x00000000430840ULL, 1211, 6},
+	{0x00000000861080ULL, 1212, 6},
+	{0x000000010c2100ULL, 1213, 6},
+	{0x00000000118840ULL, 2210, 6},
+	{0x00000000231080ULL, 2211, 6},
+	{0x00000000462100ULL, 2212, 6},
+	{0x000000008c4200ULL, 2213, 6},
+	{0x00000000000dc0ULL, 1310, 6},
+	{0x00000000001b80ULL, 1311, 6},
+	{0x00000000003860ULL, 2310, 6},
+	{0x000000000070c0ULL, 2311, 6},
+	// darkgreen, row 2
+	{0x00000004218400ULL, 1020, 6},
+	{0x00000008430800ULL, 1021, 6},
+	{0x00000010861000ULL, 1022, 6},
+	{0x000000210c2000ULL, 1023, 6},
+	{0x00000002118800ULL, 2020, 6},
+	{0x00000004231000ULL, 2021, 6},
+	{0x00000008462000ULL, 2022, 6},
+	{0x000000108c4000ULL, 2023, 6},
+	{0x0000000003b000ULL, 1120, 6},
+	{0x00000000076000ULL, 1121, 6},
+	{0x00000000061c00ULL, 2120, 6},
+	{0x000000000c3800ULL, 2121, 6},
+	{0x00000004308400ULL, 1220, 6},
+	{0x00000008610800ULL, 1221, 6},
+	{0x00000010c21000ULL, 1222, 6},
+	{0x00000021842000ULL, 1223, 6},
+	{0x00000002310800ULL, 2220, 6},
+	{0x00000004621000ULL, 2221, 6},
+	{0x00000008c42000ULL, 2222, 6},
+	{0x00000011884000ULL, 2223, 6},
+	{0x0000000001b800ULL, 1320, 6},
+	{0x00000000037000ULL, 1321, 6},
+	{0x00000000070c00ULL, 2320, 6},
+	{0x000000000e1800ULL, 2321, 6},
+	// darkgreen, row 3
+	{0x00000084308000ULL, 1030, 6},
+	{0x00000108610000ULL, 1031, 6},
+	{0x00000210c20000ULL, 1032, 6},
+	{0x00000421840000ULL, 1033, 6},
+	{0x00000042310000ULL, 2030, 6},
+	{0x00000084620000ULL, 2031, 6},
+	{0x00000108c40000ULL, 2032, 6},
+	{0x00000211880000ULL, 2033, 6},
+	{0x00000000760000ULL, 1130, 6},
+	{0x00000000ec0000ULL, 1131, 6},
+	{0x00000000c38000ULL, 2130, 6},
+	{0x00000001870000ULL, 2131, 6},
+	{0x00000086108000ULL, 1230, 6},
+	{0x0000010c210000ULL, 1231, 6},
+	{0x00000218420000ULL, 1232, 6},
+	{0x00000430840000ULL, 1233, 6},
+	{0x00000046210000ULL, 2230, 6},
+	{0x0000008c420000ULL, 2231, 6},
+	{0x00000118840000ULL, 2232, 6},
+	{0x00000231080000ULL, 2233, 6},
+	{0x00000000370000ULL, 1330, 6},
+	{0x000000006e0000ULL, 1331, 6},
+	{0x00000000e18000ULL, 2330, 6},
+	{0x00000001c30000ULL, 2331, 6},
+	// darkgreen, row 4
+	{0x00001086100000ULL, 1040, 6},
+	{0x0000210c200000ULL, 1041, 6},
+	{0x00004218400000ULL, 1042, 6},
+	{0x00008430800000ULL, 1043, 6},
+	{0x00000846200000ULL, 2040, 6},
+	{0x0000108c400000ULL, 2041, 6},
+	{0x00002118800000ULL, 2042, 6},
+	{0x00004231000000ULL, 2043, 6},
+	{0x0000000ec00000ULL, 1140, 6},
+	{0x0000001d800000ULL, 1141, 6},
+	{0x00000018700000ULL, 2140, 6},
+	{0x00000030e00000ULL, 2141, 6},
+	{0x000010c2100000ULL, 1240, 6},
+	{0x00002184200000ULL, 1241, 6},
+	{0x00004308400000ULL, 1242, 6},
+	{0x00008610800000ULL, 1243, 6},
+	{0x000008c4200000ULL, 2240, 6},
+	{0x00001188400000ULL, 2241, 6},
+	{0x00002310800000ULL, 2242, 6},
+	{0x00004621000000ULL, 2243, 6},
+	{0x00000006e00000ULL, 1340, 6},
+	{0x0000000dc00000ULL, 1341, 6},
+	{0x0000001c300000ULL, 2340, 6},
+	{0x00000038600000ULL, 2341, 6},
+	// darkgreen, row 5
+	{0x000210c2000000ULL, 1050, 6},
+	{0x00042184000000ULL, 1051, 6},
+	{0x00084308000000ULL, 1052, 6},
+	{0x00108610000000ULL, 1053, 6},
+	{0x000108c4000000ULL, 2050, 6},
+	{0x00021188000000ULL, 2051, 6},
+	{0x00042310000000ULL, 2052, 6},
+	{0x00084620000000ULL, 2053, 6},
+	{0x000001d8000000ULL, 1150, 6},
+	{0x000003b0000000ULL, 1151, 6},
+	{0x0000030e000000ULL, 2150, 6},
+	{0x0000061c000000ULL, 2151, 6},
+	{0x00021842000000ULL, 1250, 6},
+	{0x00043084000000ULL, 1251, 6},
+	{0x00086108000000ULL, 1252, 6},
+	{0x0010c210000000ULL, 1253, 6},
+	{0x00011884000000ULL, 2250, 6},
+	{0x00023108000000ULL, 2251, 6},
+	{0x00046210000000ULL, 2252, 6},
+	{0x0008c420000000ULL, 2253, 6},
+	{0x000000dc000000ULL, 1350, 6},
+	{0x000001b8000000ULL, 1351, 6},
+	{0x00000386000000ULL, 2350, 6},
+	{0x0000070c000000ULL, 2351, 6},
+	// darkgreen, row 6
+	{0x00421840000000ULL, 1060, 6},
+	{0x00843080000000ULL, 1061, 6},
+	{0x01086100000000ULL, 1062, 6},
+	{0x0210c200000000ULL, 1063, 6},
+	{0x00211880000000ULL, 2060, 6},
+	{0x00423100000000ULL, 2061, 6},
+	{0x00846200000000ULL, 2062, 6},
+	{0x0108c400000000ULL, 2063, 6},
+	{0x00003b00000000ULL, 1160, 6},
+	{0x00007600000000ULL, 1161, 6},
+	{0x000061c0000000ULL, 2160, 6},
+	{0x0000c380000000ULL, 2161, 6},
+	{0x00430840000000ULL, 1260, 6},
+	{0x00861080000000ULL, 1261, 6},
+	{0x010c2100000000ULL, 1262, 6},
+	{0x02184200000000ULL, 1263, 6},
+	{0x00231080000000ULL, 2260, 6},
+	{0x00462100000000ULL, 2261, 6},
+	{0x008c4200000000ULL, 2262, 6},
+	{0x01188400000000ULL, 2263, 6},
+	{0x00001b80000000ULL, 1360, 6},
+	{0x00003700000000ULL, 1361, 6},
+	{0x000070c0000000ULL, 2360, 6},
+	{0x0000e180000000ULL, 2361, 6},
+	// darkgreen, row 7
+	{0x08430800000000ULL, 1070, 6},
+	{0x10861000000000ULL, 1071, 6},
+	{0x210c2000000000ULL, 1072, 6},
+	{0x42184000000000ULL, 1073, 6},
+	{0x04231000000000ULL, 2070, 6},
+	{0x08462000000000ULL, 2071, 6},
+	{0x108c4000000000ULL, 2072, 6},
+	{0x21188000000000ULL, 2073, 6},
+	{0x00076000000000ULL, 1170, 6},
+	{0x000ec000000000ULL, 1171, 6},
+	{0x000c3800000000ULL, 2170, 6},
+	{0x00187000000000ULL, 2171, 6},
+	{0x08610800000000ULL, 1270, 6},
+	{0x10c21000000000ULL, 1271, 6},
+	{0x21842000000000ULL, 1272, 6},
+	{0x43084000000000ULL, 1273, 6},
+	{0x04621000000000ULL, 2270, 6},
+	{0x08c42000000000ULL, 2271, 6},
+	{0x11884000000000ULL, 2272, 6},
+	{0x23108000000000ULL, 2273, 6},
+	{0x00037000000000ULL, 1370, 6},
+	{0x0006e000000000ULL, 1371, 6},
+	{0x000e1800000000ULL, 2370, 6},
+	{0x001c3000000000ULL, 2371, 6},
+	// darkgreen, row 8
+	{0x00ec0000000000ULL, 1180, 6},
+	{0x01d80000000000ULL, 1181, 6},
+	{0x01870000000000ULL, 2180, 6},
+	{0x030e0000000000ULL, 2181, 6},
+	{0x006e0000000000ULL, 1380, 6},
+	{0x00dc0000000000ULL, 1381, 6},
+	{0x01c30000000000ULL, 2380, 6},
+	{0x03860000000000ULL, 2381, 6},
+	// darkgreen, row 9
+	{0x1d800000000000ULL, 1190, 6},
+	{0x3b000000000000ULL, 1191, 6},
+	{0x30e00000000000ULL, 2190, 6},
+	{0x61c00000000000ULL, 2191, 6},
+	{0x0dc00000000000ULL, 1390, 6},
+	{0x1b800000000000ULL, 1391, 6},
+	{0x38600000000000ULL, 2390, 6},
+	{0x70c00000000000ULL, 2391, 6},
+	// darkgreen, row 10
+	// yellow, row 0
+	{0x00000000000c23ULL, 1000, 7},
+	{0x00000000001846ULL, 1001, 7},
+	{0x0000000000308cULL, 1002, 7},
+	{0x00000000006118ULL, 1003, 7},
+	{0x000000000000a7ULL, 1100, 7},
+	{0x0000000000014eULL, 1101, 7},
+	{0x0000000000029cULL, 1102, 7},
+	{0x00000000000c43ULL, 1200, 7},
+	{0x00000000001886ULL, 1201, 7},
+	{0x0000000000310cULL, 1202, 7},
+	{0x00000000006218ULL, 1203, 7},
+	{0x000000000000e5ULL, 1300, 7},
+	{0x000000000001caULL, 1301, 7},
+	{0x00000000000394ULL, 1302, 7},
+	// yellow, row 1
+	{0x00000000018460ULL, 1010, 7},
+	{0x000000000308c0ULL, 1011, 7},
+	{0x00000000061180ULL, 1012, 7},
+	{0x000000000c2300ULL, 1013, 7},
+	{0x000000000014e0ULL, 1110, 7},
+	{0x000000000029c0ULL, 1111, 7},
+	{0x00000000005380ULL, 1112, 7},
+	{0x00000000018860ULL, 1210, 7},
+	{0x000000000310c0ULL, 1211, 7},
+	{0x00000000062180ULL, 1212, 7},
+	{0x000000000c4300ULL, 1213, 7},
+	{0x00000000001ca0ULL, 1310, 7},
+	{0x00000000003940ULL, 1311, 7},
+	{0x00000000007280ULL, 1312, 7},
+	// yellow, row 2
+	{0x00000000308c00ULL, 1020, 7},
+	{0x00000000611800ULL, 1021, 7},
+	{0x00000000c23000ULL, 1022, 7},
+	{0x00000001846000ULL, 1023, 7},
+	{0x00000000029c00ULL, 1120, 7},
+	{0x00000000053800ULL, 1121, 7},
+	{0x000000000a7000ULL, 1122, 7},
+	{0x00000000310c00ULL, 1220, 7},
+	{0x00000000621800ULL, 1221, 7},
+	{0x00000000c43000ULL, 1222, 7},
+	{0x00000001886000ULL, 1223, 7},
+	{0x00000000039400ULL, 1320, 7},
+	{0x00000000072800ULL, 1321, 7},
+	{0x000000000e5000ULL, 1322, 7},
+	// yellow, row 3
+	{0x00000006118000ULL, 1030, 7},
+	{0x0000000c230000ULL, 1031, 7},
+	{0x00000018460000ULL, 1032, 7},
+	{0x000000308c0000ULL, 1033, 7},
+	{0x00000000538000ULL, 1130, 7},
+	{0x00000000a70000ULL, 1131, 7},
+	{0x000000014e0000ULL, 1132, 7},
+	{0x00000006218000ULL, 1230, 7},
+	{0x0000000c430000ULL, 1231, 7},
+	{0x00000018860000ULL, 1232, 7},
+	{0x000000310c0000ULL, 1233, 7},
+	{0x00000000728000ULL, 1330, 7},
+	{0x00000000e50000ULL, 1331, 7},
+	{0x00000001ca0000ULL, 1332, 7},
+	// yellow, row 4
+	{0x000000c2300000ULL, 1040, 7},
+	{0x00000184600000ULL, 1041, 7},
+	{0x00000308c00000ULL, 1042, 7},
+	{0x00000611800000ULL, 1043, 7},
+	{0x0000000a700000ULL, 1140, 7},
+	{0x00000014e00000ULL, 1141, 7},
+	{0x00000029c00000ULL, 1142, 7},
+	{0x000000c4300000ULL, 1240, 7},
+	{0x00000188600000ULL, 1241, 7},
+	{0x00000310c00000ULL, 1242, 7},
+	{0x00000621800000ULL, 1243, 7},
+	{0x0000000e500000ULL, 1340, 7},
+	{0x0000001ca00000ULL, 1341, 7},
+	{0x00000039400000ULL, 1342, 7},
+	// yellow, row 5
+	{0x00001846000000ULL, 1050, 7},
+	{0x0000308c000000ULL, 1051, 7},
+	{0x00006118000000ULL, 1052, 7},
+	{0x0000c230000000ULL, 1053, 7},
+	{0x0000014e000000ULL, 1150, 7},
+	{0x0000029c000000ULL, 1151, 7},
+	{0x00000538000000ULL, 1152, 7},
+	{0x00001886000000ULL, 1250, 7},
+	{0x0000310c000000ULL, 1251, 7},
+	{0x00006218000000ULL, 1252, 7},
+	{0x0000c430000000ULL, 1253, 7},
+	{0x000001ca000000ULL, 1350, 7},
+	{0x00000394000000ULL, 1351, 7},
+	{0x00000728000000ULL, 1352, 7},
+	// yellow, row 6
+	{0x000308c0000000ULL, 1060, 7},
+	{0x00061180000000ULL, 1061, 7},
+	{0x000c2300000000ULL, 1062, 7},
+	{0x00184600000000ULL, 1063, 7},
+	{0x000029c0000000ULL, 1160, 7},
+	{0x00005380000000ULL, 1161, 7},
+	{0x0000a700000000ULL, 1162, 7},
+	{0x000310c0000000ULL, 1260, 7},
+	{0x00062180000000ULL, 1261, 7},
+	{0x000c4300000000ULL, 1262, 7},
+	{0x00188600000000ULL, 1263, 7},
+	{0x00003940000000ULL, 1360, 7},
+	{0x00007280000000ULL, 1361, 7},
+	{0x0000e500000000ULL, 1362, 7},
+	// yellow, row 7
+	{0x00611800000000ULL, 1070, 7},
+	{0x00c23000000000ULL, 1071, 7},
+	{0x01846000000000ULL, 1072, 7},
+	{0x0308c000000000ULL, 1073, 7},
+	{0x00053800000000ULL, 1170, 7},
+	{0x000a7000000000ULL, 1171, 7},
+	{0x0014e000000000ULL, 1172, 7},
+	{0x00621800000000ULL, 1270, 7},
+	{0x00c43000000000ULL, 1271, 7},
+	{0x01886000000000ULL, 1272, 7},
+	{0x0310c000000000ULL, 1273, 7},
+	{0x00072800000000ULL, 1370, 7},
+	{0x000e5000000000ULL, 1371, 7},
+	{0x001ca000000000ULL, 1372, 7},
+	// yellow, row 8
+	{0x0c230000000000ULL, 1080, 7},
+	{0x18460000000000ULL, 1081, 7},
+	{0x308c0000000000ULL, 1082, 7},
+	{0x61180000000000ULL, 1083, 7},
+	{0x00a70000000000ULL, 1180, 7},
+	{0x014e0000000000ULL, 1181, 7},
+	{0x029c0000000000ULL, 1182, 7},
+	{0x0c430000000000ULL, 1280, 7},
+	{0x18860000000000ULL, 1281, 7},
+	{0x310c0000000000ULL, 1282, 7},
+	{0x62180000000000ULL, 1283, 7},
+	{0x00e50000000000ULL, 1380, 7},
+	{0x01ca0000000000ULL, 1381, 7},
+	{0x03940000000000ULL, 1382, 7},
+	// yellow, row 9
+	{0x14e00000000000ULL, 1190, 7},
+	{0x29c00000000000ULL, 1191, 7},
+	{0x53800000000000ULL, 1192, 7},
+	{0x1ca00000000000ULL, 1390, 7},
+	{0x39400000000000ULL, 1391, 7},
+	{0x72800000000000ULL, 1392, 7},
+	// yellow, row 10
+	// lightblue, row 0
+	{0x00000000001c21ULL, 1000, 8},
+	{0x00000000003842ULL, 1001, 8},
+	{0x00000000007084ULL, 1002, 8},
+	{0x00000000000427ULL, 1100, 8},
+	{0x0000000000084eULL, 1101, 8},
+	{0x0000000000109cULL, 1102, 8},
+	{0x00000000001087ULL, 1200, 8},
+	{0x0000000000210eULL, 1201, 8},
+	{0x0000000000421cULL, 1202, 8},
+	{0x00000000001c84ULL, 1300, 8},
+	{0x00000000003908ULL, 1301, 8},
+	{0x00000000007210ULL, 1302, 8},
+	// lightblue, row 1
+	{0x00000000038420ULL, 1010, 8},
+	{0x00000000070840ULL, 1011, 8},
+	{0x000000000e1080ULL, 1012, 8},
+	{0x000000000084e0ULL, 1110, 8},
+	{0x000000000109c0ULL, 1111, 8},
+	{0x00000000021380ULL, 1112, 8},
+	{0x000000000210e0ULL, 1210, 8},
+	{0x000000000421c0ULL, 1211, 8},
+	{0x00000000084380ULL, 1212, 8},
+	{0x00000000039080ULL, 1310, 8},
+	{0x00000000072100ULL, 1311, 8},
+	{0x000000000e4200ULL, 1312, 8},
+	// lightblue, row 2
+	{0x00000000708400ULL, 1020, 8},
+	{0x00000000e10800ULL, 1021, 8},
+	{0x00000001c21000ULL, 1022, 8},
+	{0x00000000109c00ULL, 1120, 8},
+	{0x00000000213800ULL, 1121, 8},
+	{0x00000000427000ULL, 1122, 8},
+	{0x00000000421c00ULL, 1220, 8},
+	{0x00000000843800ULL, 1221, 8},
+	{0x00000001087000ULL, 1222, 8},
+	{0x00000000721000ULL, 1320, 8},
+	{0x00000000e42000ULL, 1321, 8},
+	{0x00000001c84000ULL, 1322, 8},
+	// lightblue, row 3
+	{0x0000000e108000ULL, 1030, 8},
+	{0x0000001c210000ULL, 1031, 8},
+	{0x00000038420000ULL, 1032, 8},
+	{0x00000002138000ULL, 1130, 8},
+	{0x00000004270000ULL, 1131, 8},
+	{0x000000084e0000ULL, 1132, 8},
+	{0x00000008438000ULL, 1230, 8},
+	{0x00000010870000ULL, 1231, 8},
+	{0x000000210e0000ULL, 1232, 8},
+	{0x0000000e420000ULL, 1330, 8},
+	{0x0000001c840000ULL, 1331, 8},
+	{0x00000039080000ULL, 1332, 8},
+	// lightblue, row 4
+	{0x000001c2100000ULL, 1040, 8},
+	{0x00000384200000ULL, 1041, 8},
+	{0x00000708400000ULL, 1042, 8},
+	{0x00000042700000ULL, 1140, 8},
+	{0x00000084e00000ULL, 1141, 8},
+	{0x00000109c00000ULL, 1142, 8},
+	{0x00000108700000ULL, 1240, 8},
+	{0x00000210e00000ULL, 1241, 8},
+	{0x00000421c00000ULL, 1242, 8},
+	{0x000001c8400000ULL, 1340, 8},
+	{0x00000390800000ULL, 1341, 8},
+	{0x00000721000000ULL, 1342, 8},
+	// lightblue, row 5
+	{0x00003842000000ULL, 1050, 8},
+	{0x00007084000000ULL, 1051, 8},
+	{0x0000e108000000ULL, 1052, 8},
+	{0x0000084e000000ULL, 1150, 8},
+	{0x0000109c000000ULL, 1151, 8},
+	{0x00002138000000ULL, 1152, 8},
+	{0x0000210e000000ULL, 1250, 8},
+	{0x0000421c000000ULL, 1251, 8},
+	{0x00008438000000ULL, 1252, 8},
+	{0x00003908000000ULL, 1350, 8},
+	{0x00007210000000ULL, 1351, 8},
+	{0x0000e420000000ULL, 1352, 8},
+	// lightblue, row 6
+	{0x00070840000000ULL, 1060, 8},
+	{0x000e1080000000ULL, 1061, 8},
+	{0x001c2100000000ULL, 1062, 8},
+	{0x000109c0000000ULL, 1160, 8},
+	{0x00021380000000ULL, 1161, 8},
+	{0x00042700000000ULL, 1162, 8},
+	{0x000421c0000000ULL, 1260, 8},
+	{0x00084380000000ULL, 1261, 8},
+	{0x00108700000000ULL, 1262, 8},
+	{0x00072100000000ULL, 1360, 8},
+	{0x000e4200000000ULL, 1361, 8},
+	{0x001c8400000000ULL, 1362, 8},
+	// lightblue, row 7
+	{0x00e10800000000ULL, 1070, 8},
+	{0x01c21000000000ULL, 1071, 8},
+	{0x03842000000000ULL, 1072, 8},
+	{0x00213800000000ULL, 1170, 8},
+	{0x00427000000000ULL, 1171, 8},
+	{0x0084e000000000ULL, 1172, 8},
+	{0x00843800000000ULL, 1270, 8},
+	{0x01087000000000ULL, 1271, 8},
+	{0x0210e000000000ULL, 1272, 8},
+	{0x00e42000000000ULL, 1370, 8},
+	{0x01c84000000000ULL, 1371, 8},
+	{0x03908000000000ULL, 1372, 8},
+	// lightblue, row 8
+	{0x1c210000000000ULL, 1080, 8},
+	{0x38420000000000ULL, 1081, 8},
+	{0x70840000000000ULL, 1082, 8},
+	{0x04270000000000ULL, 1180, 8},
+	{0x084e0000000000ULL, 1181, 8},
+	{0x109c0000000000ULL, 1182, 8},
+	{0x10870000000000ULL, 1280, 8},
+	{0x210e0000000000ULL, 1281, 8},
+	{0x421c0000000000ULL, 1282, 8},
+	{0x1c840000000000ULL, 1380, 8},
+	{0x39080000000000ULL, 1381, 8},
+	{0x72100000000000ULL, 1382, 8},
+	// lightblue, row 9
+	// lightblue, row 10
+	// pink, row 0
+	{0x00000000001861ULL, 1000, 9},
+	{0x000000000030c2ULL, 1001, 9},
+	{0x00000000006184ULL, 1002, 9},
+	{0x00000000000466ULL, 1100, 9},
+	{0x000000000008ccULL, 1101, 9},
+	{0x00000000001198ULL, 1102, 9},
+	{0x000000000010c3ULL, 1200, 9},
+	{0x00000000002186ULL, 1201, 9},
+	{0x0000000000430cULL, 1202, 9},
+	{0x00000000000cc4ULL, 1300, 9},
+	{0x00000000001988ULL, 1301, 9},
+	{0x00000000003310ULL, 1302, 9},
+	// pink, row 1
+	{0x00000000030c20ULL, 1010, 9},
+	{0x00000000061840ULL, 1011, 9},
+	{0x000000000c3080ULL, 1012, 9},
+	{0x00000000008cc0ULL, 1110, 9},
+	{0x00000000011980ULL, 1111, 9},
+	{0x00000000023300ULL, 1112, 9},
+	{0x00000000021860ULL, 1210, 9},
+	{0x000000000430c0ULL, 1211, 9},
+	{0x00000000086180ULL, 1212, 9},
+	{0x00000000019880ULL, 1310, 9},
+	{0x00000000033100ULL, 1311, 9},
+	{0x00000000066200ULL, 1312, 9},
+	// pink, row 2
+	{0x00000000618400ULL, 1020, 9},
+	{0x00000000c30800ULL, 1021, 9},
+	{0x00000001861000ULL, 1022, 9},
+	{0x00000000119800ULL, 1120, 9},
+	{0x00000000233000ULL, 1121, 9},
+	{0x00000000466000ULL, 1122, 9},
+	{0x00000000430c00ULL, 1220, 9},
+	{0x00000000861800ULL, 1221, 9},
+	{0x000000010c3000ULL, 1222, 9},
+	{0x00000000331000ULL, 1320, 9},
+	{0x00000000662000ULL, 1321, 9},
+	{0x00000000cc4000ULL, 1322, 9},
+	// pink, row 3
+	{0x0000000c308000ULL, 1030, 9},
+	{0x00000018610000ULL, 1031, 9},
+	{0x00000030c20000ULL, 1032, 9},
+	{0x00000002330000ULL, 1130, 9},
+	{0x00000004660000ULL, 1131, 9},
+	{0x00000008cc0000ULL, 1132, 9},
+	{0x00000008618000ULL, 1230, 9},
+	{0x00000010c30000ULL, 1231, 9},
+	{0x00000021860000ULL, 1232, 9},
+	{0x00000006620000ULL, 1330, 9},
+	{0x0000000cc40000ULL, 1331, 9},
+	{0x00000019880000ULL, 1332, 9},
+	// pink, row 4
+	{0x00000186100000ULL, 1040, 9},
+	{0x0000030c200000ULL, 1041, 9},
+	{0x00000618400000ULL, 1042, 9},
+	{0x00000046600000ULL, 1140, 9},
+	{0x0000008cc00000ULL, 1141, 9},
+	{0x00000119800000ULL, 1142, 9},
+	{0x0000010c300000ULL, 1240, 9},
+	{0x00000218600000ULL, 1241, 9},
+	{0x00000430c00000ULL, 1242, 9},
+	{0x000000cc400000ULL, 1340, 9},
+	{0x00000198800000ULL, 1341, 9},
+	{0x00000331000000ULL, 1342, 9},
+	// pink, row 5
+	{0x000030c2000000ULL, 1050, 9},
+	{0x00006184000000ULL, 1051, 9},
+	{0x0000c308000000ULL, 1052, 9},
+	{0x000008cc000000ULL, 1150, 9},
+	{0x00001198000000ULL, 1151, 9},
+	{0x00002330000000ULL, 1152, 9},
+	{0x00002186000000ULL, 1250, 9},
+	{0x0000430c000000ULL, 1251, 9},
+	{0x00008618000000ULL, 1252, 9},
+	{0x00001988000000ULL, 1350, 9},
+	{0x00003310000000ULL, 1351, 9},
+	{0x00006620000000ULL, 1352, 9},
+	// pink, row 6
+	{0x00061840000000ULL, 1060, 9},
+	{0x000c3080000000ULL, 1061, 9},
+	{0x00186100000000ULL, 1062, 9},
+	{0x00011980000000ULL, 1160, 9},
+	{0x00023300000000ULL, 1161, 9},
+	{0x00046600000000ULL, 1162, 9},
+	{0x000430c0000000ULL, 1260, 9},
+	{0x00086180000000ULL, 1261, 9},
+	{0x0010c300000000ULL, 1262, 9},
+	{0x00033100000000ULL, 1360, 9},
+	{0x00066200000000ULL, 1361, 9},
+	{0x000cc400000000ULL, 1362, 9},
+	// pink, row 7
+	{0x00c30800000000ULL, 1070, 9},
+	{0x01861000000000ULL, 1071, 9},
+	{0x030c2000000000ULL, 1072, 9},
+	{0x00233000000000ULL, 1170, 9},
+	{0x00466000000000ULL, 1171, 9},
+	{0x008cc000000000ULL, 1172, 9},
+	{0x00861800000000ULL, 1270, 9},
+	{0x010c3000000000ULL, 1271, 9},
+	{0x02186000000000ULL, 1272, 9},
+	{0x00662000000000ULL, 1370, 9},
+	{0x00cc4000000000ULL, 1371, 9},
+	{0x01988000000000ULL, 1372, 9},
+	// pink, row 8
+	{0x18610000000000ULL, 1080, 9},
+	{0x30c20000000000ULL, 1081, 9},
+	{0x61840000000000ULL, 1082, 9},
+	{0x04660000000000ULL, 1180, 9},
+	{0x08cc0000000000ULL, 1181, 9},
+	{0x11980000000000ULL, 1182, 9},
+	{0x10c30000000000ULL, 1280, 9},
+	{0x21860000000000ULL, 1281, 9},
+	{0x430c0000000000ULL, 1282, 9},
+	{0x0cc40000000000ULL, 1380, 9},
+	{0x19880000000000ULL, 1381, 9},
+	{0x33100000000000ULL, 1382, 9},
+	// pink, row 9
+	// pink, row 10
+	// pinkish, row 0
+	{0x00000000008c21ULL, 1000, 10},
+	{0x00000000011842ULL, 1001, 10},
+	{0x00000000023084ULL, 1002, 10},
+	{0x00000000046108ULL, 1003, 10},
+	{0x00000000010c42ULL, 2000, 10},
+	{0x00000000021884ULL, 2001, 10},
+	{0x00000000043108ULL, 2002, 10},
+	{0x00000000086210ULL, 2003, 10},
+	{0x0000000000004fULL, 1100, 10},
+	{0x0000000000009eULL, 1101, 10},
+	{0x000000000001e2ULL, 2100, 10},
+	{0x000000000003c4ULL, 2101, 10},
+	{0x00000000010862ULL, 1200, 10},
+	{0x000000000210c4ULL, 1201, 10},
+	{0x00000000042188ULL, 1202, 10},
+	{0x00000000084310ULL, 1203, 10},
+	{0x00000000008461ULL, 2200, 10},
+	{0x000000000108c2ULL, 2201, 10},
+	{0x00000000021184ULL, 2202, 10},
+	{0x00000000042308ULL, 2203, 10},
+	{0x000000000001e4ULL, 1300, 10},
+	{0x000000000003c8ULL, 1301, 10},
+	{0x0000000000008fULL, 2300, 10},
+	{0x0000000000011eULL, 2301, 10},
+	// pinkish, row 1
+	{0x00000000118420ULL, 1010, 10},
+	{0x00000000230840ULL, 1011, 10},
+	{0x00000000461080ULL, 1012, 10},
+	{0x000000008c2100ULL, 1013, 10},
+	{0x00000000218840ULL, 2010, 10},
+	{0x00000000431080ULL, 2011, 10},
+	{0x00000000862100ULL, 2012, 10},
+	{0x000000010c4200ULL, 2013, 10},
+	{0x000000000009e0ULL, 1110, 10},
+	{0x000000000013c0ULL, 1111, 10},
+	{0x00000000003c40ULL, 2110, 10},
+	{0x00000000007880ULL, 2111, 10},
+	{0x00000000210c40ULL, 1210, 10},
+	{0x00000000421880ULL, 1211, 10},
+	{0x00000000843100ULL, 1212, 10},
+	{0x00000001086200ULL, 1213, 10},
+	{0x00000000108c20ULL, 2210, 10},
+	{0x00000000211840ULL, 2211, 10},
+	{0x00000000423080ULL, 2212, 10},
+	{0x00000000846100ULL, 2213, 10},
+	{0x00000000003c80ULL, 1310, 10},
+	{0x00000000007900ULL, 1311, 10},
+	{0x000000000011e0ULL, 2310, 10},
+	{0x000000000023c0ULL, 2311, 10},
+	// pinkish, row 2
+	{0x00000002308400ULL, 1020, 10},
+	{0x00000004610800ULL, 1021, 10},
+	{0x00000008c21000ULL, 1022, 10},
+	{0x00000011842000ULL, 1023, 10},
+	{0x00000004310800ULL, 2020, 10},
+	{0x00000008621000ULL, 2021, 10},
+	{0x00000010c42000ULL, 2022, 10},
+	{0x00000021884000ULL, 2023, 10},
+	{0x00000000013c00ULL, 1120, 10},
+	{0x00000000027800ULL, 1121, 10},
+	{0x00000000078800ULL, 2120, 10},
+	{0x000000000f1000ULL, 2121, 10},
+	{0x00000004218800ULL, 1220, 10},
+	{0x00000008431000ULL, 1221, 10},
+	{0x00000010862000ULL, 1222, 10},
+	{0x000000210c4000ULL, 1223, 10},
+	{0x00000002118400ULL, 2220, 10},
+	{0x00000004230800ULL, 2221, 10},
+	{0x00000008461000ULL, 2222, 10},
+	{0x000000108c2000ULL, 2223, 10},
+	{0x00000000079000ULL, 1320, 10},
+	{0x000000000f2000ULL, 1321, 10},
+	{0x00000000023c00ULL, 2320, 10},
+	{0x00000000047800ULL, 2321, 10},
+	// pinkish, row 3
+	{0x00000046108000ULL, 1030, 10},
+	{0x0000008c210000ULL, 1031, 10},
+	{0x00000118420000ULL, 1032, 10},
+	{0x00000230840000ULL, 1033, 10},
+	{0x00000086210000ULL, 2030, 10},
+	{0x0000010c420000ULL, 2031, 10},
+	{0x00000218840000ULL, 2032, 10},
+	{0x00000431080000ULL, 2033, 10},
+	{0x00000000278000ULL, 1130, 10},
+	{0x000000004f0000ULL, 1131, 10},
+	{0x00000000f10000ULL, 2130, 10},
+	{0x00000001e20000ULL, 2131, 10},
+	{0x00000084310000ULL, 1230, 10},
+	{0x00000108620000ULL, 1231, 10},
+	{0x00000210c40000ULL, 1232, 10},
+	{0x00000421880000ULL, 1233, 10},
+	{0x00000042308000ULL, 2230, 10},
+	{0x00000084610000ULL, 2231, 10},
+	{0x00000108c20000ULL, 2232, 10},
+	{0x00000211840000ULL, 2233, 10},
+	{0x00000000f20000ULL, 1330, 10},
+	{0x00000001e40000ULL, 1331, 10},
+	{0x00000000478000ULL, 2330, 10},
+	{0x000000008f0000ULL, 2331, 10},
+	// pinkish, row 4
+	{0x000008c2100000ULL, 1040, 10},
+	{0x00001184200000ULL, 1041, 10},
+	{0x00002308400000ULL, 1042, 10},
+	{0x00004610800000ULL, 1043, 10},
+	{0x000010c4200000ULL, 2040, 10},
+	{0x00002188400000ULL, 2041, 10},
+	{0x00004310800000ULL, 2042, 10},
+	{0x00008621000000ULL, 2043, 10},
+	{0x00000004f00000ULL, 1140, 10},
+	{0x00000009e00000ULL, 1141, 10},
+	{0x0000001e200000ULL, 2140, 10},
+	{0x0000003c400000ULL, 2141, 10},
+	{0x00001086200000ULL, 1240, 10},
+	{0x0000210c400000ULL, 1241, 10},
+	{0x00004218800000ULL, 1242, 10},
+	{0x00008431000000ULL, 1243, 10},
+	{0x00000846100000ULL, 2240, 10},
+	{0x0000108c200000ULL, 2241, 10},
+	{0x00002118400000ULL, 2242, 10},
+	{0x00004230800000ULL, 2243, 10},
+	{0x0000001e400000ULL, 1340, 10},
+	{0x0000003c800000ULL, 1341, 10},
+	{0x00000008f00000ULL, 2340, 10},
+	{0x00000011e00000ULL, 2341, 10},
+	// pinkish, row 5
+	{0x00011842000000ULL, 1050, 10},
+	{0x00023084000000ULL, 1051, 10},
+	{0x00046108000000ULL, 1052, 10},
+	{0x0008c210000000ULL, 1053, 10},
+	{0x00021884000000ULL, 2050, 10},
+	{0x00043108000000ULL, 2051, 10},
+	{0x00086210000000ULL, 2052, 10},
+	{0x0010c420000000ULL, 2053, 10},
+	{0x0000009e000000ULL, 1150, 10},
+	{0x0000013c000000ULL, 1151, 10},
+	{0x000003c4000000ULL, 2150, 10},
+	{0x00000788000000ULL, 2151, 10},
+	{0x000210c4000000ULL, 1250, 10},
+	{0x00042188000000ULL, 1251, 10},
+	{0x00084310000000ULL, 1252, 10},
+	{0x00108620000000ULL, 1253, 10},
+	{0x000108c2000000ULL, 2250, 10},
+	{0x00021184000000ULL, 2251, 10},
+	{0x00042308000000ULL, 2252, 10},
+	{0x00084610000000ULL, 2253, 10},
+	{0x000003c8000000ULL, 1350, 10},
+	{0x00000790000000ULL, 1351, 10},
+	{0x0000011e000000ULL, 2350, 10},
+	{0x0000023c000000ULL, 2351, 10},
+	// pinkish, row 6
+	{0x00230840000000ULL, 1060, 10},
+	{0x00461080000000ULL, 1061, 10},
+	{0x008c2100000000ULL, 1062, 10},
+	{0x01184200000000ULL, 1063, 10},
+	{0x00431080000000ULL, 2060, 10},
+	{0x00862100000000ULL, 2061, 10},
+	{0x010c4200000000ULL, 2062, 10},
+	{0x02188400000000ULL, 2063, 10},
+	{0x000013c0000000ULL, 1160, 10},
+	{0x00002780000000ULL, 1161, 10},
+	{0x00007880000000ULL, 2160, 10},
+	{0x0000f100000000ULL, 2161, 10},
+	{0x00421880000000ULL, 1260, 10},
+	{0x00843100000000ULL, 1261, 10},
+	{0x01086200000000ULL, 1262, 10},
+	{0x0210c400000000ULL, 1263, 10},
+	{0x00211840000000ULL, 2260, 10},
+	{0x00423080000000ULL, 2261, 10},
+	{0x00846100000000ULL, 2262, 10},
+	{0x0108c200000000ULL, 2263, 10},
+	{0x00007900000000ULL, 1360, 10},
+	{0x0000f200000000ULL, 1361, 10},
+	{0x000023c0000000ULL, 2360, 10},
+	{0x00004780000000ULL, 2361, 10},
+	// pinkish, row 7
+	{0x04610800000000ULL, 1070, 10},
+	{0x08c21000000000ULL, 1071, 10},
+	{0x11842000000000ULL, 1072, 10},
+	{0x23084000000000ULL, 1073, 10},
+	{0x08621000000000ULL, 2070, 10},
+	{0x10c42000000000ULL, 2071, 10},
+	{0x21884000000000ULL, 2072, 10},
+	{0x43108000000000ULL, 2073, 10},
+	{0x00027800000000ULL, 1170, 10},
+	{0x0004f000000000ULL, 1171, 10},
+	{0x000f1000000000ULL, 2170, 10},
+	{0x001e2000000000ULL, 2171, 10},
+	{0x08431000000000ULL, 1270, 10},
+	{0x10862000000000ULL, 1271, 10},
+	{0x210c4000000000ULL, 1272, 10},
+	{0x42188000000000ULL, 1273, 10},
+	{0x04230800000000ULL, 2270, 10},
+	{0x08461000000000ULL, 2271, 10},
+	{0x108c2000000000ULL, 2272, 10},
+	{0x21184000000000ULL, 2273, 10},
+	{0x000f2000000000ULL, 1370, 10},
+	{0x001e4000000000ULL, 1371, 10},
+	{0x00047800000000ULL, 2370, 10},
+	{0x0008f000000000ULL, 2371, 10},
+	// pinkish, row 8
+	{0x004f0000000000ULL, 1180, 10},
+	{0x009e0000000000ULL, 1181, 10},
+	{0x01e20000000000ULL, 2180, 10},
+	{0x03c40000000000ULL, 2181, 10},
+	{0x01e40000000000ULL, 1380, 10},
+	{0x03c80000000000ULL, 1381, 10},
+	{0x008f0000000000ULL, 2380, 10},
+	{0x011e0000000000ULL, 2381, 10},
+	// pinkish, row 9
+	{0x09e00000000000ULL, 1190, 10},
+	{0x13c00000000000ULL, 1191, 10},
+	{0x3c400000000000ULL, 2190, 10},
+	{0x78800000000000ULL, 2191, 10},
+	{0x3c800000000000ULL, 1390, 10},
+	{0x79000000000000ULL, 1391, 10},
+	{0x11e00000000000ULL, 2390, 10},
+	{0x23c00000000000ULL, 2391, 10},
+	// pinkish, row 10
+	// blue, row 0
+	{0x00000000018421ULL, 1000, 11},
+	{0x00000000030842ULL, 1001, 11},
+	{0x00000000061084ULL, 1002, 11},
+	{0x000000000c2108ULL, 1003, 11},
+	{0x00000000018842ULL, 2000, 11},
+	{0x00000000031084ULL, 2001, 11},
+	{0x00000000062108ULL, 2002, 11},
+	{0x000000000c4210ULL, 2003, 11},
+	{0x0000000000002fULL, 1100, 11},
+	{0x0000000000005eULL, 1101, 11},
+	{0x000000000001e1ULL, 2100, 11},
+	{0x000000000003c2ULL, 2101, 11},
+	{0x00000000010843ULL, 1200, 11},
+	{0x00000000021086ULL, 1201, 11},
+	{0x0000000004210cULL, 1202, 11},
+	{0x00000000084218ULL, 1203, 11},
+	{0x00000000008423ULL, 2200, 11},
+	{0x00000000010846ULL, 2201, 11},
+	{0x0000000002108cULL, 2202, 11},
+	{0x00000000042118ULL, 2203, 11},
+	{0x000000000001e8ULL, 1300, 11},
+	{0x000000000003d0ULL, 1301, 11},
+	{0x0000000000010fULL, 2300, 11},
+	{0x0000000000021eULL, 2301, 11},
+	// blue, row 1
+	{0x00000000308420ULL, 1010, 11},
+	{0x00000000610840ULL, 1011, 11},
+	{0x00000000c21080ULL, 1012, 11},
+	{0x00000001842100ULL, 1013, 11},
+	{0x00000000310840ULL, 2010, 11},
+	{0x00000000621080ULL, 2011, 11},
+	{0x00000000c42100ULL, 2012, 11},
+	{0x00000001884200ULL, 2013, 11},
+	{0x000000000005e0ULL, 1110, 11},
+	{0x00000000000bc0ULL, 1111, 11},
+	{0x00000000003c20ULL, 2110, 11},
+	{0x00000000007840ULL, 2111, 11},
+	{0x00000000210860ULL, 1210, 11},
+	{0x000000004210c0ULL, 1211, 11},
+	{0x00000000842180ULL, 1212, 11},
+	{0x00000001084300ULL, 1213, 11},
+	{0x00000000108460ULL, 2210, 11},
+	{0x000000002108c0ULL, 2211, 11},
+	{0x00000000421180ULL, 2212, 11},
+	{0x00000000842300ULL, 2213, 11},
+	{0x00000000003d00ULL, 1310, 11},
+	{0x00000000007a00ULL, 1311, 11},
+	{0x000000000021e0ULL, 2310, 11},
+	{0x000000000043c0ULL, 2311, 11},
+	// blue, row 2
+	{0x00000006108400ULL, 1020, 11},
+	{0x0000000c210800ULL, 1021, 11},
+	{0x00000018421000ULL, 1022, 11},
+	{0x00000030842000ULL, 1023, 11},
+	{0x00000006210800ULL, 2020, 11},
+	{0x0000000c421000ULL, 2021, 11},
+	{0x00000018842000ULL, 2022, 11},
+	{0x00000031084000ULL, 2023, 11},
+	{0x0000000000bc00ULL, 1120, 11},
+	{0x00000000017800ULL, 1121, 11},
+	{0x00000000078400ULL, 2120, 11},
+	{0x000000000f0800ULL, 2121, 11},
+	{0x00000004210c00ULL, 1220, 11},
+	{0x00000008421800ULL, 1221, 11},
+	{0x00000010843000ULL, 1222, 11},
+	{0x00000021086000ULL, 1223, 11},
+	{0x00000002108c00ULL, 2220, 11},
+	{0x00000004211800ULL, 2221, 11},
+	{0x00000008423000ULL, 2222, 11},
+	{0x00000010846000ULL, 2223, 11},
+	{0x0000000007a000ULL, 1320, 11},
+	{0x000000000f4000ULL, 1321, 11},
+	{0x00000000043c00ULL, 2320, 11},
+	{0x00000000087800ULL, 2321, 11},
+	// blue, row 3
+	{0x000000c2108000ULL, 1030, 11},
+	{0x00000184210000ULL, 1031, 11},
+	{0x00000308420000ULL, 1032, 11},
+	{0x00000610840000ULL, 1033, 11},
+	{0x000000c4210000ULL, 2030, 11},
+	{0x00000188420000ULL, 2031, 11},
+	{0x00000310840000ULL, 2032, 11},
+	{0x00000621080000ULL, 2033, 11},
+	{0x00000000178000ULL, 1130, 11},
+	{0x000000002f0000ULL, 1131, 11},
+	{0x00000000f08000ULL, 2130, 11},
+	{0x00000001e10000ULL, 2131, 11},
+	{0x00000084218000ULL, 1230, 11},
+	{0x00000108430000ULL, 1231, 11},
+	{0x00000210860000ULL, 1232, 11},
+	{0x000004210c0000ULL, 1233, 11},
+	{0x00000042118000ULL, 2230, 11},
+	{0x00000084230000ULL, 2231, 11},
+	{0x00000108460000ULL, 2232, 11},
+	{0x000002108c0000ULL, 2233, 11},
+	{0x00000000f40000ULL, 1330, 11},
+	{0x00000001e80000ULL, 1331, 11},
+	{0x00000000878000ULL, 2330, 11},
+	{0x000000010f0000ULL, 2331, 11},
+	// blue, row 4
+	{0x00001842100000ULL, 1040, 11},
+	{0x00003084200000ULL, 1041, 11},
+	{0x00006108400000ULL, 1042, 11},
+	{0x0000c210800000ULL, 1043, 11},
+	{0x00001884200000ULL, 2040, 11},
+	{0x00003108400000ULL, 2041, 11},
+	{0x00006210800000ULL, 2042, 11},
+	{0x0000c421000000ULL, 2043, 11},
+	{0x00000002f00000ULL, 1140, 11},
+	{0x00000005e00000ULL, 1141, 11},
+	{0x0000001e100000ULL, 2140, 11},
+	{0x0000003c200000ULL, 2141, 11},
+	{0x00001084300000ULL, 1240, 11},
+	{0x00002108600000ULL, 1241, 11},
+	{0x00004210c00000ULL, 1242, 11},
+	{0x00008421800000ULL, 1243, 11},
+	{0x00000842300000ULL, 2240, 11},
+	{0x00001084600000ULL, 2241, 11},
+	{0x00002108c00000ULL, 2242, 11},
+	{0x00004211800000ULL, 2243, 11},
+	{0x0000001e800000ULL, 1340, 11},
+	{0x0000003d000000ULL, 1341, 11},
+	{0x00000010f00000ULL, 2340, 11},
+	{0x00000021e00000ULL, 2341, 11},
+	// blue, row 5
+	{0x00030842000000ULL, 1050, 11},
+	{0x00061084000000ULL, 1051, 11},
+	{0x000c2108000000ULL, 1052, 11},
+	{0x00184210000000ULL, 1053, 11},
+	{0x00031084000000ULL, 2050, 11},
+	{0x00062108000000ULL, 2051, 11},
+	{0x000c4210000000ULL, 2052, 11},
+	{0x00188420000000ULL, 2053, 11},
+	{0x0000005e000000ULL, 1150, 11},
+	{0x000000bc000000ULL, 1151, 11},
+	{0x000003c2000000ULL, 2150, 11},
+	{0x00000784000000ULL, 2151, 11},
+	{0x00021086000000ULL, 1250, 11},
+	{0x0004210c000000ULL, 1251, 11},
+	{0x00084218000000ULL, 1252, 11},
+	{0x00108430000000ULL, 1253, 11},
+	{0x00010846000000ULL, 2250, 11},
+	{0x0002108c000000ULL, 2251, 11},
+	{0x00042118000000ULL, 2252, 11},
+	{0x00084230000000ULL, 2253, 11},
+	{0x000003d0000000ULL, 1350, 11},
+	{0x000007a0000000ULL, 1351, 11},
+	{0x0000021e000000ULL, 2350, 11},
+	{0x0000043c000000ULL, 2351, 11},
+	// blue, row 6
+	{0x00610840000000ULL, 1060, 11},
+	{0x00c21080000000ULL, 1061, 11},
+	{0x01842100000000ULL, 1062, 11},
+	{0x03084200000000ULL, 1063, 11},
+	{0x00621080000000ULL, 2060, 11},
+	{0x00c42100000000ULL, 2061, 11},
+	{0x01884200000000ULL, 2062, 11},
+	{0x03108400000000ULL, 2063, 11},
+	{0x00000bc0000000ULL, 1160, 11},
+	{0x00001780000000ULL, 1161, 11},
+	{0x00007840000000ULL, 2160, 11},
+	{0x0000f080000000ULL, 2161, 11},
+	{0x004210c0000000ULL, 1260, 11},
+	{0x00842180000000ULL, 1261, 11},
+	{0x01084300000000ULL, 1262, 11},
+	{0x02108600000000ULL, 1263, 11},
+	{0x002108c0000000ULL, 2260, 11},
+	{0x00421180000000ULL, 2261, 11},
+	{0x00842300000000ULL, 2262, 11},
+	{0x01084600000000ULL, 2263, 11},
+	{0x00007a00000000ULL, 1360, 11},
+	{0x0000f400000000ULL, 1361, 11},
+	{0x000043c0000000ULL, 2360, 11},
+	{0x00008780000000ULL, 2361, 11},
+	// blue, row 7
+	{0x0c210800000000ULL, 1070, 11},
+	{0x18421000000000ULL, 1071, 11},
+	{0x30842000000000ULL, 1072, 11},
+	{0x61084000000000ULL, 1073, 11},
+	{0x0c421000000000ULL, 2070, 11},
+	{0x18842000000000ULL, 2071, 11},
+	{0x31084000000000ULL, 2072, 11},
+	{0x62108000000000ULL, 2073, 11},
+	{0x00017800000000ULL, 1170, 11},
+	{0x0002f000000000ULL, 1171, 11},
+	{0x000f0800000000ULL, 2170, 11},
+	{0x001e1000000000ULL, 2171, 11},
+	{0x08421800000000ULL, 1270, 11},
+	{0x10843000000000ULL, 1271, 11},
+	{0x21086000000000ULL, 1272, 11},
+	{0x4210c000000000ULL, 1273, 11},
+	{0x04211800000000ULL, 2270, 11},
+	{0x08423000000000ULL, 2271, 11},
+	{0x10846000000000ULL, 2272, 11},
+	{0x2108c000000000ULL, 2273, 11},
+	{0x000f4000000000ULL, 1370, 11},
+	{0x001e8000000000ULL, 1371, 11},
+	{0x00087800000000ULL, 2370, 11},
+	{0x0010f000000000ULL, 2371, 11},
+	// blue, row 8
+	{0x002f0000000000ULL, 1180, 11},
+	{0x005e0000000000ULL, 1181, 11},
+	{0x01e10000000000ULL, 2180, 11},
+	{0x03c20000000000ULL, 2181, 11},
+	{0x01e80000000000ULL, 1380, 11},
+	{0x03d00000000000ULL, 1381, 11},
+	{0x010f0000000000ULL, 2380, 11},
+	{0x021e0000000000ULL, 2381, 11},
+	// blue, row 9
+	{0x05e00000000000ULL, 1190, 11},
+	{0x0bc00000000000ULL, 1191, 11},
+	{0x3c200000000000ULL, 2190, 11},
+	{0x78400000000000ULL, 2191, 11},
+	{0x3d000000000000ULL, 1390, 11},
+	{0x7a000000000000ULL, 1391, 11},
+	{0x21e00000000000ULL, 2390, 11},
+	{0x43c00000000000ULL, 2391, 11},
+	// blue, row 10
+};
+
+/**
+ * Placements of piece i with the left upper corner in row y are placements[first_placement[i*BOARD_HEIGHT + y]]
+ * up to (excluding) placements[first_placement[i*BOARD_HEIGHT + y + 1]].
+ */
+static const short first_placement[NPIECES*BOARD_HEIGHT + 1] = {
+	0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160,
+	160, 164, 168, 172, 176, 180, 184, 188, 192, 196, 200,
+	200, 228, 256, 284, 312, 340, 368, 396, 424, 452, 464,
+	464, 471, 478, 485, 492, 499, 506, 513, 520, 522, 524,
+	526, 529, 532, 535, 538, 541, 544, 547, 550, 553, 553,
+	553, 581, 609, 637, 665, 693, 721, 749, 777, 805, 817,
+	817, 841, 865, 889, 913, 937, 961, 985, 1009, 1017, 1025,
+	1025, 1039, 1053, 1067, 1081, 1095, 1109, 1123, 1137, 1151, 1157,
+	1157, 1169, 1181, 1193, 1205, 1217, 1229, 1241, 1253, 1265, 1265,
+	1265, 1277, 1289, 1301, 1313, 1325, 1337, 1349, 1361, 1373, 1373,
+	1373, 1397, 1421, 1445, 1469, 1493, 1517, 1541, 1565, 1573, 1581,
+	1581, 1605, 1629, 1653, 1677, 1701, 1725, 1749, 1773, 1781, 1789,
+	1789,
+};
+
+#define NPLACEMENTS 1789
+
+/**
+ * Placements covering site s (y*BOARD_WIDTH + x) are placements[covering_placements[k]] for k from first_covering[s]
+ * up to (excluding) first_covering[s+1].
+ */
+static const short covering_placements[] = {
+	0, 4, 8, 160, 200, 208, 211, 214, 218, 225, 464, 469, 553, 561, 564, 567, 571, 578, 817, 827, 829, 839, 1025, 1029, 1032, 1036, 1157, 1160, 1163, 1265, 1271, 1373, 1381, 1389, 1395, 1581, 1589, 1591, 1593, 1597, 1603,
+	1, 4, 5, 8, 9, 12, 160, 161, 201, 204, 208, 209, 212, 214, 215, 218, 219, 225, 226, 465, 469, 470, 526, 554, 557, 561, 562, 564, 565, 567, 568, 571, 572, 575, 578, 579, 818, 821, 827, 828, 830, 833, 837, 839, 840, 1025, 1026, 1029, 1030, 1032, 1033, 1037, 1158, 1160, 1161, 1163, 1164, 1266, 1268, 1271, 1272, 1374, 1377, 1381, 1382, 1383, 1385, 1390, 1395, 1396, 1582, 1585, 1589, 1590, 1592, 1593, 1594, 1597, 1598, 1603, 1604,
+	2, 5, 6, 9, 10, 13, 161, 162, 202, 205, 208, 209, 210, 213, 215, 216, 219, 220, 222, 225, 226, 227, 466, 469, 470, 527, 555, 558, 561, 562, 563, 565, 566, 568, 569, 572, 573, 575, 576, 578, 579, 580, 819, 822, 825, 827, 828, 831, 834, 837, 838, 840, 1026, 1027, 1029, 1030, 1031, 1033, 1034, 1036, 1038, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1267, 1268, 1269, 1272, 1273, 1274, 1375, 1378, 1381, 1382, 1384, 1386, 1391, 1393, 1395, 1396, 1583, 1586, 1589, 1590, 1594, 1595, 1598, 1599, 1603, 1604,
+	3, 6, 7, 10, 11, 14, 162, 163, 203, 206, 209, 210, 216, 217, 220, 221, 223, 226, 227, 467, 469, 470, 528, 556, 559, 562, 563, 566, 569, 570, 573, 574, 576, 577, 579, 580, 820, 823, 825, 826, 828, 832, 835, 837, 838, 1027, 1028, 1030, 1031, 1034, 1035, 1037, 1161, 1162, 1164, 1165, 1167, 1269, 1270, 1273, 1275, 1376, 1379, 1381, 1382, 1387, 1392, 1394, 1395, 1396, 1584, 1587, 1589, 1590, 1595, 1596, 1599, 1600, 1601, 1603, 1604,
+	7, 11, 15, 163, 207, 210, 217, 221, 224, 227, 468, 470, 560, 563, 570, 574, 577, 580, 824, 826, 836, 838, 1028, 1031, 1035, 1038, 1162, 1165, 1168, 1270, 1276, 1380, 1382, 1388, 1396, 1588, 1590, 1596, 1600, 1602, 1604,
+	0, 4, 12, 16, 20, 24, 160, 164, 200, 208, 211, 218, 222, 228, 236, 239, 242, 246, 253, 464, 471, 476, 526, 553, 557, 561, 564, 567, 571, 575, 581, 589, 592, 595, 599, 606, 817, 821, 825, 829, 837, 841, 851, 853, 863, 1025, 1029, 1036, 1039, 1043, 1046, 1050, 1157, 1160, 1169, 1172, 1175, 1265, 1268, 1277, 1283, 1373, 1383, 1385, 1389, 1393, 1397, 1405, 1413, 1419, 1581, 1589, 1591, 1597, 1601, 1605, 1613, 1615, 1617, 1621, 1627,
+	0, 1, 5, 8, 12, 13, 17, 20, 21, 24, 25, 28, 160, 161, 164, 165, 201, 204, 209, 211, 212, 214, 219, 222, 223, 229, 232, 236, 237, 240, 242, 243, 246, 247, 253, 254, 465, 472, 476, 477, 526, 527, 529, 553, 554, 557, 558, 561, 562, 564, 565, 567, 568, 571, 572, 575, 576, 578, 582, 585, 589, 590, 592, 593, 595, 596, 599, 600, 603, 606, 607, 817, 818, 821, 822, 825, 826, 830, 833, 837, 838, 839, 842, 845, 851, 852, 854, 857, 861, 863, 864, 1026, 1030, 1032, 1036, 1037, 1039, 1040, 1043, 1044, 1046, 1047, 1051, 1158, 1161, 1170, 1172, 1173, 1175, 1176, 1265, 1266, 1268, 1269, 1271, 1274, 1278, 1280, 1283, 1284, 1374, 1377, 1381, 1383, 1384, 1385, 1386, 1389, 1390, 1393, 1394, 1398, 1401, 1405, 1406, 1407, 1409, 1414, 1419, 1420, 1582, 1585, 1590, 1591, 1592, 1593, 1598, 1601, 1602, 1606, 1609, 1613, 1614, 1616, 1617, 1618, 1621, 1622, 1627, 1628,
+	1, 2, 6, 9, 13, 14, 18, 21, 22, 25, 26, 29, 161, 162, 165, 166, 202, 205, 210, 211, 212, 213, 215, 220, 222, 223, 224, 225, 230, 233, 236, 237, 238, 241, 243, 244, 247, 248, 250, 253, 254, 255, 466, 473, 476, 477, 526, 527, 528, 530, 554, 555, 558, 559, 562, 563, 564, 565, 566, 568, 569, 572, 573, 575, 576, 577, 578, 579, 583, 586, 589, 590, 591, 593, 594, 596, 597, 600, 601, 603, 604, 606, 607, 608, 818, 819, 822, 823, 825, 826, 827, 831, 834, 838, 839, 840, 843, 846, 849, 851, 852, 855, 858, 861, 862, 864, 1027, 1029, 1031, 1033, 1036, 1037, 1038, 1040, 1041, 1043, 1044, 1045, 1047, 1048, 1050, 1052, 1159, 1162, 1163, 1166, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1266, 1267, 1269, 1270, 1271, 1272, 1274, 1275, 1279, 1280, 1281, 1284, 1285, 1286, 1375, 1378, 1382, 1383, 1384, 1386, 1387, 1390, 1391, 1393, 1394, 1395, 1399, 1402, 1405, 1406, 1408, 1410, 1415, 1417, 1419, 1420, 1583, 1586, 1591, 1592, 1594, 1599, 1601, 1602, 1607, 1610, 1613, 1614, 1618, 1619, 1622, 1623, 1627, 1628,
+	2, 3, 7, 10, 14, 15, 19, 22, 23, 26, 27, 30, 162, 163, 166, 167, 203, 206, 212, 213, 216, 221, 223, 224, 226, 231, 234, 237, 238, 244, 245, 248, 249, 251, 254, 255, 467, 474, 476, 477, 527, 528, 531, 555, 556, 559, 560, 563, 565, 566, 569, 570, 573, 574, 576, 577, 579, 580, 584, 587, 590, 591, 594, 597, 598, 601, 602, 604, 605, 607, 608, 819, 820, 823, 824, 826, 827, 828, 832, 835, 839, 840, 844, 847, 849, 850, 852, 856, 859, 861, 862, 1028, 1030, 1034, 1037, 1038, 1041, 1042, 1044, 1045, 1048, 1049, 1051, 1164, 1167, 1173, 1174, 1176, 1177, 1179, 1267, 1270, 1272, 1273, 1275, 1276, 1281, 1282, 1285, 1287, 1376, 1379, 1383, 1384, 1387, 1388, 1391, 1392, 1393, 1394, 1396, 1400, 1403, 1405, 1406, 1411, 1416, 1418, 1419, 1420, 1584, 1587, 1591, 1592, 1595, 1600, 1601, 1602, 1603, 1608, 1611, 1613, 1614, 1619, 1620, 1623, 1624, 1625, 1627, 1628,
+	3, 11, 15, 23, 27, 31, 163, 167, 207, 213, 217, 224, 227, 235, 238, 245, 249, 252, 255, 468, 475, 477, 528, 556, 560, 566, 570, 574, 577, 580, 588, 591, 598, 602, 605, 608, 820, 824, 828, 836, 840, 848, 850, 860, 862, 1031, 1035, 1038, 1042, 1045, 1049, 1052, 1165, 1168, 1174, 1177, 1180, 1273, 1276, 1282, 1288, 1380, 1384, 1388, 1392, 1394, 1404, 1406, 1412, 1420, 1588, 1592, 1596, 1602, 1604, 1612, 1614, 1620, 1624, 1626, 1628,
+	16, 20, 28, 32, 36, 40, 164, 168, 200, 204, 218, 228, 236, 239, 246, 250, 256, 264, 267, 270, 274, 281, 464, 471, 478, 483, 529, 553, 557, 571, 581, 585, 589, 592, 595, 599, 603, 609, 617, 620, 623, 627, 634, 821, 829, 833, 841, 845, 849, 853, 861, 865, 875, 877, 887, 1025, 1032, 1039, 1043, 1050, 1053, 1057, 1060, 1064, 1157, 1160, 1166, 1169, 1172, 1181, 1184, 1187, 1268, 1274, 1277, 1280, 1289, 1295, 1373, 1377, 1389, 1397, 1407, 1409, 1413, 1417, 1421, 1429, 1437, 1443, 1581, 1597, 1605, 1613, 1615, 1621, 1625, 1629, 1637, 1639, 1641, 1645, 1651,
+	16, 17, 21, 24, 28, 29, 33, 36, 37, 40, 41, 44, 164, 165, 168, 169, 200, 201, 204, 205, 214, 219, 229, 232, 237, 239, 240, 242, 247, 250, 251, 257, 260, 264, 265, 268, 270, 271, 274, 275, 281, 282, 465, 472, 479, 483, 484, 526, 529, 530, 532, 553, 554, 557, 558, 567, 572, 581, 582, 585, 586, 589, 590, 592, 593, 595, 596, 599, 600, 603, 604, 606, 610, 613, 617, 618, 620, 621, 623, 624, 627, 628, 631, 634, 635, 817, 822, 829, 830, 833, 834, 841, 842, 845, 846, 849, 850, 854, 857, 861, 862, 863, 866, 869, 875, 876, 878, 881, 885, 887, 888, 1025, 1026, 1032, 1033, 1040, 1044, 1046, 1050, 1051, 1053, 1054, 1057, 1058, 1060, 1061, 1065, 1157, 1158, 1161, 1166, 1167, 1170, 1173, 1182, 1184, 1185, 1187, 1188, 1265, 1269, 1274, 1275, 1277, 1278, 1280, 1281, 1283, 1286, 1290, 1292, 1295, 1296, 1373, 1374, 1377, 1378, 1385, 1390, 1398, 1401, 1405, 1407, 1408, 1409, 1410, 1413, 1414, 1417, 1418, 1422, 1425, 1429, 1430, 1431, 1433, 1438, 1443, 1444, 1582, 1585, 1593, 1598, 1606, 1609, 1614, 1615, 1616, 1617, 1622, 1625, 1626, 1630, 1633, 1637, 1638, 1640, 1641, 1642, 1645, 1646, 1651, 1652,
+	17, 18, 22, 25, 29, 30, 34, 37, 38, 41, 42, 45, 165, 166, 169, 170, 201, 202, 205, 206, 215, 220, 230, 233, 238, 239, 240, 241, 243, 248, 250, 251, 252, 253, 258, 261, 264, 265, 266, 269, 271, 272, 275, 276, 278, 281, 282, 283, 466, 473, 480, 483, 484, 527, 529, 530, 531, 533, 554, 555, 558, 559, 568, 573, 582, 583, 586, 587, 590, 591, 592, 593, 594, 596, 597, 600, 601, 603, 604, 605, 606, 607, 611, 614, 617, 618, 619, 621, 622, 624, 625, 628, 629, 631, 632, 634, 635, 636, 818, 823, 830, 831, 834, 835, 842, 843, 846, 847, 849, 850, 851, 855, 858, 862, 863, 864, 867, 870, 873, 875, 876, 879, 882, 885, 886, 888, 1026, 1027, 1033, 1034, 1041, 1043, 1045, 1047, 1050, 1051, 1052, 1054, 1055, 1057, 1058, 1059, 1061, 1062, 1064, 1066, 1157, 1158, 1159, 1162, 1163, 1166, 1167, 1168, 1171, 1174, 1175, 1178, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1265, 1266, 1270, 1271, 1275, 1276, 1278, 1279, 1281, 1282, 1283, 1284, 1286, 1287, 1291, 1292, 1293, 1296, 1297, 1298, 1374, 1375, 1378, 1379, 1386, 1391, 1399, 1402, 1406, 1407, 1408, 1410, 1411, 1414, 1415, 1417, 1418, 1419, 1423, 1426, 1429, 1430, 1432, 1434, 1439, 1441, 1443, 1444, 1583, 1586, 1594, 1599, 1607, 1610, 1615, 1616, 1618, 1623, 1625, 1626, 1631, 1634, 1637, 1638, 1642, 1643, 1646, 1647, 1651, 1652,
+	18, 19, 23, 26, 30, 31, 35, 38, 39, 42, 43, 46, 166, 167, 170, 171, 202, 203, 206, 207, 216, 221, 231, 234, 240, 241, 244, 249, 251, 252, 254, 259, 262, 265, 266, 272, 273, 276, 277, 279, 282, 283, 467, 474, 481, 483, 484, 528, 530, 531, 534, 555, 556, 559, 560, 569, 574, 583, 584, 587, 588, 591, 593, 594, 597, 598, 601, 602, 604, 605, 607, 608, 612, 615, 618, 619, 622, 625, 626, 629, 630, 632, 633, 635, 636, 819, 824, 831, 832, 835, 836, 843, 844, 847, 848, 850, 851, 852, 856, 859, 863, 864, 868, 871, 873, 874, 876, 880, 883, 885, 886, 1027, 1028, 1034, 1035, 1042, 1044, 1048, 1051, 1052, 1055, 1056, 1058, 1059, 1062, 1063, 1065, 1158, 1159, 1164, 1167, 1168, 1176, 1179, 1185, 1186, 1188, 1189, 1191, 1266, 1267, 1272, 1276, 1279, 1282, 1284, 1285, 1287, 1288, 1293, 1294, 1297, 1299, 1375, 1376, 1379, 1380, 1387, 1392, 1400, 1403, 1407, 1408, 1411, 1412, 1415, 1416, 1417, 1418, 1420, 1424, 1427, 1429, 1430, 1435, 1440, 1442, 1443, 1444, 1584, 1587, 1595, 1600, 1608, 1611, 1615, 1616, 1619, 1624, 1625, 1626, 1627, 1632, 1635, 1637, 1638, 1643, 1644, 1647, 1648, 1649, 1651, 1652,
+	19, 27, 31, 39, 43, 47, 167, 171, 203, 207, 217, 235, 241, 245, 252, 255, 263, 266, 273, 277, 280, 283, 468, 475, 482, 484, 531, 556, 560, 570, 584, 588, 594, 598, 602, 605, 608, 616, 619, 626, 630, 633, 636, 820, 832, 836, 844, 848, 852, 860, 864, 872, 874, 884, 886, 1028, 1035, 1045, 1049, 1052, 1056, 1059, 1063, 1066, 1159, 1165, 1168, 1177, 1180, 1186, 1189, 1192, 1267, 1273, 1285, 1288, 1294, 1300, 1376, 1380, 1388, 1404, 1408, 1412, 1416, 1418, 1428, 1430, 1436, 1444, 1588, 1596, 1612, 1616, 1620, 1626, 1628, 1636, 1638, 1644, 1648, 1650, 1652,
+	32, 36, 44, 48, 52, 56, 168, 172, 228, 232, 246, 256, 264, 267, 274, 278, 284, 292, 295, 298, 302, 309, 464, 471, 478, 485, 490, 532, 581, 585, 599, 609, 613, 617, 620, 623, 627, 631, 637, 645, 648, 651, 655, 662, 821, 833, 845, 853, 857, 865, 869, 873, 877, 885, 889, 899, 901, 911, 1039, 1046, 1053, 1057, 1064, 1067, 1071, 1074, 1078, 1169, 1172, 1178, 1181, 1184, 1193, 1196, 1199, 1280, 1286, 1289, 1292, 1301, 1307, 1373, 1389, 1397, 1401, 1413, 1421, 1431, 1433, 1437, 1441, 1445, 1453, 1461, 1467, 1581, 1585, 1597, 1605, 1621, 1629, 1637, 1639, 1645, 1649, 1653, 1661, 1663, 1665, 1669, 1675,
+	32, 33, 37, 40, 44, 45, 49, 52, 53, 56, 57, 60, 168, 169, 172, 173, 228, 229, 232, 233, 242, 247, 257, 260, 265, 267, 268, 270, 275, 278, 279, 285, 288, 292, 293, 296, 298, 299, 302, 303, 309, 310, 465, 472, 479, 486, 490, 491, 529, 532, 533, 535, 581, 582, 585, 586, 595, 600, 609, 610, 613, 614, 617, 618, 620, 621, 623, 624, 627, 628, 631, 632, 634, 638, 641, 645, 646, 648, 649, 651, 652, 655, 656, 659, 662, 663, 817, 822, 829, 834, 841, 846, 853, 854, 857, 858, 865, 866, 869, 870, 873, 874, 878, 881, 885, 886, 887, 890, 893, 899, 900, 902, 905, 909, 911, 912, 1039, 1040, 1046, 1047, 1054, 1058, 1060, 1064, 1065, 1067, 1068, 1071, 1072, 1074, 1075, 1079, 1169, 1170, 1173, 1178, 1179, 1182, 1185, 1194, 1196, 1197, 1199, 1200, 1277, 1281, 1286, 1287, 1289, 1290, 1292, 1293, 1295, 1298, 1302, 1304, 1307, 1308, 1374, 1377, 1385, 1390, 1397, 1398, 1401, 1402, 1409, 1414, 1422, 1425, 1429, 1431, 1432, 1433, 1434, 1437, 1438, 1441, 1442, 1446, 1449, 1453, 1454, 1455, 1457, 1462, 1467, 1468, 1581, 1582, 1585, 1586, 1593, 1598, 1606, 1609, 1617, 1622, 1630, 1633, 1638, 1639, 1640, 1641, 1646, 1649, 1650, 1654, 1657, 1661, 1662, 1664, 1665, 1666, 1669, 1670, 1675, 1676,
+	33, 34, 38, 41, 45, 46, 50, 53, 54, 57, 58, 61, 169, 170, 173, 174, 229, 230, 233, 234, 243, 248, 258, 261, 266, 267, 268, 269, 271, 276, 278, 279, 280, 281, 286, 289, 292, 293, 294, 297, 299, 300, 303, 304, 306, 309, 310, 311, 466, 473, 480, 487, 490, 491, 530, 532, 533, 534, 536, 582, 583, 586, 587, 596, 601, 610, 611, 614, 615, 618, 619, 620, 621, 622, 624, 625, 628, 629, 631, 632, 633, 634, 635, 639, 642, 645, 646, 647, 649, 650, 652, 653, 656, 657, 659, 660, 662, 663, 664, 818, 823, 830, 835, 842, 847, 854, 855, 858, 859, 866, 867, 870, 871, 873, 874, 875, 879, 882, 886, 887, 888, 891, 894, 897, 899, 900, 903, 906, 909, 910, 912, 1040, 1041, 1047, 1048, 1055, 1057, 1059, 1061, 1064, 1065, 1066, 1068, 1069, 1071, 1072, 1073, 1075, 1076, 1078, 1080, 1169, 1170, 1171, 1174, 1175, 1178, 1179, 1180, 1183, 1186, 1187, 1190, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1277, 1278, 1282, 1283, 1287, 1288, 1290, 1291, 1293, 1294, 1295, 1296, 1298, 1299, 1303, 1304, 1305, 1308, 1309, 1310, 1375, 1378, 1386, 1391, 1398, 1399, 1402, 1403, 1410, 1415, 1423, 1426, 1430, 1431, 1432, 1434, 1435, 1438, 1439, 1441, 1442, 1443, 1447, 1450, 1453, 1454, 1456, 1458, 1463, 1465, 1467, 1468, 1582, 1583, 1586, 1587, 1594, 1599, 1607, 1610, 1618, 1623, 1631, 1634, 1639, 1640, 1642, 1647, 1649, 1650, 1655, 1658, 1661, 1662, 1666, 1667, 1670, 1671, 1675, 1676,
+	34, 35, 39, 42, 46, 47, 51, 54, 55, 58, 59, 62, 170, 171, 174, 175, 230, 231, 234, 235, 244, 249, 259, 262, 268, 269, 272, 277, 279, 280, 282, 287, 290, 293, 294, 300, 301, 304, 305, 307, 310, 311, 467, 474, 481, 488, 490, 491, 531, 533, 534, 537, 583, 584, 587, 588, 597, 602, 611, 612, 615, 616, 619, 621, 622, 625, 626, 629, 630, 632, 633, 635, 636, 640, 643, 646, 647, 650, 653, 654, 657, 658, 660, 661, 663, 664, 819, 824, 831, 836, 843, 848, 855, 856, 859, 860, 867, 868, 871, 872, 874, 875, 876, 880, 883, 887, 888, 892, 895, 897, 898, 900, 904, 907, 909, 910, 1041, 1042, 1048, 1049, 1056, 1058, 1062, 1065, 1066, 1069, 1070, 1072, 1073, 1076, 1077, 1079, 1170, 1171, 1176, 1179, 1180, 1188, 1191, 1197, 1198, 1200, 1201, 1203, 1278, 1279, 1284, 1288, 1291, 1294, 1296, 1297, 1299, 1300, 1305, 1306, 1309, 1311, 1376, 1379, 1387, 1392, 1399, 1400, 1403, 1404, 1411, 1416, 1424, 1427, 1431, 1432, 1435, 1436, 1439, 1440, 1441, 1442, 1444, 1448, 1451, 1453, 1454, 1459, 1464, 1466, 1467, 1468, 1583, 1584, 1587, 1588, 1595, 1600, 1608, 1611, 1619, 1624, 1632, 1635, 1639, 1640, 1643, 1648, 1649, 1650, 1651, 1656, 1659, 1661, 1662, 1667, 1668, 1671, 1672, 1673, 1675, 1676,
+	35, 43, 47, 55, 59, 63, 171, 175, 231, 235, 245, 263, 269, 273, 280, 283, 291, 294, 301, 305, 308, 311, 468, 475, 482, 489, 491, 534, 584, 588, 598, 612, 616, 622, 626, 630, 633, 636, 644, 647, 654, 658, 661, 664, 820, 832, 844, 856, 860, 868, 872, 876, 884, 888, 896, 898, 908, 910, 1042, 1049, 1059, 1063, 1066, 1070, 1073, 1077, 1080, 1171, 1177, 1180, 1189, 1192, 1198, 1201, 1204, 1279, 1285, 1297, 1300, 1306, 1312, 1380, 1388, 1400, 1404, 1412, 1428, 1432, 1436, 1440, 1442, 1452, 1454, 1460, 1468, 1584, 1588, 1596, 1612, 1620, 1636, 1640, 1644, 1650, 1652, 1660, 1662, 1668, 1672, 1674, 1676,
+	48, 52, 60, 64, 68, 72, 172, 176, 256, 260, 274, 284, 292, 295, 302, 306, 312, 320, 323, 326, 330, 337, 471, 478, 485, 492, 497, 535, 609, 613, 627, 637, 641, 645, 648, 651, 655, 659, 665, 673, 676, 679, 683, 690, 845, 857, 869, 877, 881, 889, 893, 897, 901, 909, 913, 923, 925, 935, 1053, 1060, 1067, 1071, 1078, 1081, 1085, 1088, 1092, 1181, 1184, 1190, 1193, 1196, 1205, 1208, 1211, 1292, 1298, 1301, 1304, 1313, 1319, 1397, 1413, 1421, 1425, 1437, 1445, 1455, 1457, 1461, 1465, 1469, 1477, 1485, 1491, 1605, 1609, 1621, 1629, 1645, 1653, 1661, 1663, 1669, 1673, 1677, 1685, 1687, 1689, 1693, 1699,
+	48, 49, 53, 56, 60, 61, 65, 68, 69, 72, 73, 76, 172, 173, 176, 177, 256, 257, 260, 261, 270, 275, 285, 288, 293, 295, 296, 298, 303, 306, 307, 313, 316, 320, 321, 324, 326, 327, 330, 331, 337, 338, 472, 479, 486, 493, 497, 498, 532, 535, 536, 538, 609, 610, 613, 614, 623, 628, 637, 638, 641, 642, 645, 646, 648, 649, 651, 652, 655, 656, 659, 660, 662, 666, 669, 673, 674, 676, 677, 679, 680, 683, 684, 687, 690, 691, 841, 846, 853, 858, 865, 870, 877, 878, 881, 882, 889, 890, 893, 894, 897, 898, 902, 905, 909, 910, 911, 914, 917, 923, 924, 926, 929, 933, 935, 936, 1053, 1054, 1060, 1061, 1068, 1072, 1074, 1078, 1079, 1081, 1082, 1085, 1086, 1088, 1089, 1093, 1181, 1182, 1185, 1190, 1191, 1194, 1197, 1206, 1208, 1209, 1211, 1212, 1289, 1293, 1298, 1299, 1301, 1302, 1304, 1305, 1307, 1310, 1314, 1316, 1319, 1320, 1398, 1401, 1409, 1414, 1421, 1422, 1425, 1426, 1433, 1438, 1446, 1449, 1453, 1455, 1456, 1457, 1458, 1461, 1462, 1465, 1466, 1470, 1473, 1477, 1478, 1479, 1481, 1486, 1491, 1492, 1605, 1606, 1609, 1610, 1617, 1622, 1630, 1633, 1641, 1646, 1654, 1657, 1662, 1663, 1664, 1665, 1670, 1673, 1674, 1678, 1681, 1685, 1686, 1688, 1689, 1690, 1693, 1694, 1699, 1700,
+	49, 50, 54, 57, 61, 62, 66, 69, 70, 73, 74, 77, 173, 174, 177, 178, 257, 258, 261, 262, 271, 276, 286, 289, 294, 295, 296, 297, 299, 304, 306, 307, 308, 309, 314, 317, 320, 321, 322, 325, 327, 328, 331, 332, 334, 337, 338, 339, 473, 480, 487, 494, 497, 498, 533, 535, 536, 537, 539, 610, 611, 614, 615, 624, 629, 638, 639, 642, 643, 646, 647, 648, 649, 650, 652, 653, 656, 657, 659, 660, 661, 662, 663, 667, 670, 673, 674, 675, 677, 678, 680, 681, 684, 685, 687, 688, 690, 691, 692, 842, 847, 854, 859, 866, 871, 878, 879, 882, 883, 890, 891, 894, 895, 897, 898, 899, 903, 906, 910, 911, 912, 915, 918, 921, 923, 924, 927, 930, 933, 934, 936, 1054, 1055, 1061, 1062, 1069, 1071, 1073, 1075, 1078, 1079, 1080, 1082, 1083, 1085, 1086, 1087, 1089, 1090, 1092, 1094, 1181, 1182, 1183, 1186, 1187, 1190, 1191, 1192, 1195, 1198, 1199, 1202, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1289, 1290, 1294, 1295, 1299, 1300, 1302, 1303, 1305, 1306, 1307, 1308, 1310, 1311, 1315, 1316, 1317, 1320, 1321, 1322, 1399, 1402, 1410, 1415, 1422, 1423, 1426, 1427, 1434, 1439, 1447, 1450, 1454, 1455, 1456, 1458, 1459, 1462, 1463, 1465, 1466, 1467, 1471, 1474, 1477, 1478, 1480, 1482, 1487, 1489, 1491, 1492, 1606, 1607, 1610, 1611, 1618, 1623, 1631, 1634, 1642, 1647, 1655, 1658, 1663, 1664, 1666, 1671, 1673, 1674, 1679, 1682, 1685, 1686, 1690, 1691, 1694, 1695, 1699, 1700,
+	50, 51, 55, 58, 62, 63, 67, 70, 71, 74, 75, 78, 174, 175, 178, 179, 258, 259, 262, 263, 272, 277, 287, 290, 296, 297, 300, 305, 307, 308, 310, 315, 318, 321, 322, 328, 329, 332, 333, 335, 338, 339, 474, 481, 488, 495, 497, 498, 534, 536, 537, 540, 611, 612, 615, 616, 625, 630, 639, 640, 643, 644, 647, 649, 650, 653, 654, 657, 658, 660, 661, 663, 664, 668, 671, 674, 675, 678, 681, 682, 685, 686, 688, 689, 691, 692, 843, 848, 855, 860, 867, 872, 879, 880, 883, 884, 891, 892, 895, 896, 898, 899, 900, 904, 907, 911, 912, 916, 919, 921, 922, 924, 928, 931, 933, 934, 1055, 1056, 1062, 1063, 1070, 1072, 1076, 1079, 1080, 1083, 1084, 1086, 1087, 1090, 1091, 1093, 1182, 1183, 1188, 1191, 1192, 1200, 1203, 1209, 1210, 1212, 1213, 1215, 1290, 1291, 1296, 1300, 1303, 1306, 1308, 1309, 1311, 1312, 1317, 1318, 1321, 1323, 1400, 1403, 1411, 1416, 1423, 1424, 1427, 1428, 1435, 1440, 1448, 1451, 1455, 1456, 1459, 1460, 1463, 1464, 1465, 1466, 1468, 1472, 1475, 1477, 1478, 1483, 1488, 1490, 1491, 1492, 1607, 1608, 1611, 1612, 1619, 1624, 1632, 1635, 1643, 1648, 1656, 1659, 1663, 1664, 1667, 1672, 1673, 1674, 1675, 1680, 1683, 1685, 1686, 1691, 1692, 1695, 1696, 1697, 1699, 1700,
+	51, 59, 63, 71, 75, 79, 175, 179, 259, 263, 273, 291, 297, 301, 308, 311, 319, 322, 329, 333, 336, 339, 475, 482, 489, 496, 498, 537, 612, 616, 626, 640, 644, 650, 654, 658, 661, 664, 672, 675, 682, 686, 689, 692, 844, 856, 868, 880, 884, 892, 896, 900, 908, 912, 920, 922, 932, 934, 1056, 1063, 1073, 1077, 1080, 1084, 1087, 1091, 1094, 1183, 1189, 1192, 1201, 1204, 1210, 1213, 1216, 1291, 1297, 1309, 1312, 1318, 1324, 1404, 1412, 1424, 1428, 1436, 1452, 1456, 1460, 1464, 1466, 1476, 1478, 1484, 1492, 1608, 1612, 1620, 1636, 1644, 1660, 1664, 1668, 1674, 1676, 1684, 1686, 1692, 1696, 1698, 1700,
+	64, 68, 76, 80, 84, 88, 176, 180, 284, 288, 302, 312, 320, 323, 330, 334, 340, 348, 351, 354, 358, 365, 478, 485, 492, 499, 504, 538, 637, 641, 655, 665, 669, 673, 676, 679, 683, 687, 693, 701, 704, 707, 711, 718, 869, 881, 893, 901, 905, 913, 917, 921, 925, 933, 937, 947, 949, 959, 1067, 1074, 1081, 1085, 1092, 1095, 1099, 1102, 1106, 1193, 1196, 1202, 1205, 1208, 1217, 1220, 1223, 1304, 1310, 1313, 1316, 1325, 1331, 1421, 1437, 1445, 1449, 1461, 1469, 1479, 1481, 1485, 1489, 1493, 1501, 1509, 1515, 1629, 1633, 1645, 1653, 1669, 1677, 1685, 1687, 1693, 1697, 1701, 1709, 1711, 1713, 1717, 1723,
+	64, 65, 69, 72, 76, 77, 81, 84, 85, 88, 89, 92, 176, 177, 180, 181, 284, 285, 288, 289, 298, 303, 313, 316, 321, 323, 324, 326, 331, 334, 335, 341, 344, 348, 349, 352, 354, 355, 358, 359, 365, 366, 479, 486, 493, 500, 504, 505, 535, 538, 539, 541, 637, 638, 641, 642, 651, 656, 665, 666, 669, 670, 673, 674, 676, 677, 679, 680, 683, 684, 687, 688, 690, 694, 697, 701, 702, 704, 705, 707, 708, 711, 712, 715, 718, 719, 865, 870, 877, 882, 889, 894, 901, 902, 905, 906, 913, 914, 917, 918, 921, 922, 926, 929, 933, 934, 935, 938, 941, 947, 948, 950, 953, 957, 959, 960, 1067, 1068, 1074, 1075, 1082, 1086, 1088, 1092, 1093, 1095, 1096, 1099, 1100, 1102, 1103, 1107, 1193, 1194, 1197, 1202, 1203, 1206, 1209, 1218, 1220, 1221, 1223, 1224, 1301, 1305, 1310, 1311, 1313, 1314, 1316, 1317, 1319, 1322, 1326, 1328, 1331, 1332, 1422, 1425, 1433, 1438, 1445, 1446, 1449, 1450, 1457, 1462, 1470, 1473, 1477, 1479, 1480, 1481, 1482, 1485, 1486, 1489, 1490, 1494, 1497, 1501, 1502, 1503, 1505, 1510, 1515, 1516, 1629, 1630, 1633, 1634, 1641, 1646, 1654, 1657, 1665, 1670, 1678, 1681, 1686, 1687, 1688, 1689, 1694, 1697, 1698, 1702, 1705, 1709, 1710, 1712, 1713, 1714, 1717, 1718, 1723, 1724,
+	65, 66, 70, 73, 77, 78, 82, 85, 86, 89, 90, 93, 177, 178, 181, 182, 285, 286, 289, 290, 299, 304, 314, 317, 322, 323, 324, 325, 327, 332, 334, 335, 336, 337, 342, 345, 348, 349, 350, 353, 355, 356, 359, 360, 362, 365, 366, 367, 480, 487, 494, 501, 504, 505, 536, 538, 539, 540, 542, 638, 639, 642, 643, 652, 657, 666, 667, 670, 671, 674, 675, 676, 677, 678, 680, 681, 684, 685, 687, 688, 689, 690, 691, 695, 698, 701, 702, 703, 705, 706, 708, 709, 712, 713, 715, 716, 718, 719, 720, 866, 871, 878, 883, 890, 895, 902, 903, 906, 907, 914, 915, 918, 919, 921, 922, 923, 927, 930, 934, 935, 936, 939, 942, 945, 947, 948, 951, 954, 957, 958, 960, 1068, 1069, 1075, 1076, 1083, 1085, 1087, 1089, 1092, 1093, 1094, 1096, 1097, 1099, 1100, 1101, 1103, 1104, 1106, 1108, 1193, 1194, 1195, 1198, 1199, 1202, 1203, 1204, 1207, 1210, 1211, 1214, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1301, 1302, 1306, 1307, 1311, 1312, 1314, 1315, 1317, 1318, 1319, 1320, 1322, 1323, 1327, 1328, 1329, 1332, 1333, 1334, 1423, 1426, 1434, 1439, 1446, 1447, 1450, 1451, 1458, 1463, 1471, 1474, 1478, 1479, 1480, 1482, 1483, 1486, 1487, 1489, 1490, 1491, 1495, 1498, 1501, 1502, 1504, 1506, 1511, 1513, 1515, 1516, 1630, 1631, 1634, 1635, 1642, 1647, 1655, 1658, 1666, 1671, 1679, 1682, 1687, 1688, 1690, 1695, 1697, 1698, 1703, 1706, 1709, 1710, 1714, 1715, 1718, 1719, 1723, 1724,
+	66, 67, 71, 74, 78, 79, 83, 86, 87, 90, 91, 94, 178, 179, 182, 183, 286, 287, 290, 291, 300, 305, 315, 318, 324, 325, 328, 333, 335, 336, 338, 343, 346, 349, 350, 356, 357, 360, 361, 363, 366, 367, 481, 488, 495, 502, 504, 505, 537, 539, 540, 543, 639, 640, 643, 644, 653, 658, 667, 668, 671, 672, 675, 677, 678, 681, 682, 685, 686, 688, 689, 691, 692, 696, 699, 702, 703, 706, 709, 710, 713, 714, 716, 717, 719, 720, 867, 872, 879, 884, 891, 896, 903, 904, 907, 908, 915, 916, 919, 920, 922, 923, 924, 928, 931, 935, 936, 940, 943, 945, 946, 948, 952, 955, 957, 958, 1069, 1070, 1076, 1077, 1084, 1086, 1090, 1093, 1094, 1097, 1098, 1100, 1101, 1104, 1105, 1107, 1194, 1195, 1200, 1203, 1204, 1212, 1215, 1221, 1222, 1224, 1225, 1227, 1302, 1303, 1308, 1312, 1315, 1318, 1320, 1321, 1323, 1324, 1329, 1330, 1333, 1335, 1424, 1427, 1435, 1440, 1447, 1448, 1451, 1452, 1459, 1464, 1472, 1475, 1479, 1480, 1483, 1484, 1487, 1488, 1489, 1490, 1492, 1496, 1499, 1501, 1502, 1507, 1512, 1514, 1515, 1516, 1631, 1632, 1635, 1636, 1643, 1648, 1656, 1659, 1667, 1672, 1680, 1683, 1687, 1688, 1691, 1696, 1697, 1698, 1699, 1704, 1707, 1709, 1710, 1715, 1716, 1719, 1720, 1721, 1723, 1724,
+	67, 75, 79, 87, 91, 95, 179, 183, 287, 291, 301, 319, 325, 329, 336, 339, 347, 350, 357, 361, 364, 367, 482, 489, 496, 503, 505, 540, 640, 644, 654, 668, 672, 678, 682, 686, 689, 692, 700, 703, 710, 714, 717, 720, 868, 880, 892, 904, 908, 916, 920, 924, 932, 936, 944, 946, 956, 958, 1070, 1077, 1087, 1091, 1094, 1098, 1101, 1105, 1108, 1195, 1201, 1204, 1213, 1216, 1222, 1225, 1228, 1303, 1309, 1321, 1324, 1330, 1336, 1428, 1436, 1448, 1452, 1460, 1476, 1480, 1484, 1488, 1490, 1500, 1502, 1508, 1516, 1632, 1636, 1644, 1660, 1668, 1684, 1688, 1692, 1698, 1700, 1708, 1710, 1716, 1720, 1722, 1724,
+	80, 84, 92, 96, 100, 104, 180, 184, 312, 316, 330, 340, 348, 351, 358, 362, 368, 376, 379, 382, 386, 393, 485, 492, 499, 506, 511, 541, 665, 669, 683, 693, 697, 701, 704, 707, 711, 715, 721, 729, 732, 735, 739, 746, 893, 905, 917, 925, 929, 937, 941, 945, 949, 957, 961, 971, 973, 983, 1081, 1088, 1095, 1099, 1106, 1109, 1113, 1116, 1120, 1205, 1208, 1214, 1217, 1220, 1229, 1232, 1235, 1316, 1322, 1325, 1328, 1337, 1343, 1445, 1461, 1469, 1473, 1485, 1493, 1503, 1505, 1509, 1513, 1517, 1525, 1533, 1539, 1653, 1657, 1669, 1677, 1693, 1701, 1709, 1711, 1717, 1721, 1725, 1733, 1735, 1737, 1741, 1747,
+	80, 81, 85, 88, 92, 93, 97, 100, 101, 104, 105, 108, 180, 181, 184, 185, 312, 313, 316, 317, 326, 331, 341, 344, 349, 351, 352, 354, 359, 362, 363, 369, 372, 376, 377, 380, 382, 383, 386, 387, 393, 394, 486, 493, 500, 507, 511, 512, 538, 541, 542, 544, 665, 666, 669, 670, 679, 684, 693, 694, 697, 698, 701, 702, 704, 705, 707, 708, 711, 712, 715, 716, 718, 722, 725, 729, 730, 732, 733, 735, 736, 739, 740, 743, 746, 747, 889, 894, 901, 906, 913, 918, 925, 926, 929, 930, 937, 938, 941, 942, 945, 946, 950, 953, 957, 958, 959, 962, 965, 971, 972, 974, 977, 981, 983, 984, 1081, 1082, 1088, 1089, 1096, 1100, 1102, 1106, 1107, 1109, 1110, 1113, 1114, 1116, 1117, 1121, 1205, 1206, 1209, 1214, 1215, 1218, 1221, 1230, 1232, 1233, 1235, 1236, 1313, 1317, 1322, 1323, 1325, 1326, 1328, 1329, 1331, 1334, 1338, 1340, 1343, 1344, 1446, 1449, 1457, 1462, 1469, 1470, 1473, 1474, 1481, 1486, 1494, 1497, 1501, 1503, 1504, 1505, 1506, 1509, 1510, 1513, 1514, 1518, 1521, 1525, 1526, 1527, 1529, 1534, 1539, 1540, 1653, 1654, 1657, 1658, 1665, 1670, 1678, 1681, 1689, 1694, 1702, 1705, 1710, 1711, 1712, 1713, 1718, 1721, 1722, 1726, 1729, 1733, 1734, 1736, 1737, 1738, 1741, 1742, 1747, 1748,
+	81, 82, 86, 89, 93, 94, 98, 101, 102, 105, 106, 109, 181, 182, 185, 186, 313, 314, 317, 318, 327, 332, 342, 345, 350, 351, 352, 353, 355, 360, 362, 363, 364, 365, 370, 373, 376, 377, 378, 381, 383, 384, 387, 388, 390, 393, 394, 395, 487, 494, 501, 508, 511, 512, 539, 541, 542, 543, 545, 666, 667, 670, 671, 680, 685, 694, 695, 698, 699, 702, 703, 704, 705, 706, 708, 709, 712, 713, 715, 716, 717, 718, 719, 723, 726, 729, 730, 731, 733, 734, 736, 737, 740, 741, 743, 744, 746, 747, 748, 890, 895, 902, 907, 914, 919, 926, 927, 930, 931, 938, 939, 942, 943, 945, 946, 947, 951, 954, 958, 959, 960, 963, 966, 969, 971, 972, 975, 978, 981, 982, 984, 1082, 1083, 1089, 1090, 1097, 1099, 1101, 1103, 1106, 1107, 1108, 1110, 1111, 1113, 1114, 1115, 1117, 1118, 1120, 1122, 1205, 1206, 1207, 1210, 1211, 1214, 1215, 1216, 1219, 1222, 1223, 1226, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1313, 1314, 1318, 1319, 1323, 1324, 1326, 1327, 1329, 1330, 1331, 1332, 1334, 1335, 1339, 1340, 1341, 1344, 1345, 1346, 1447, 1450, 1458, 1463, 1470, 1471, 1474, 1475, 1482, 1487, 1495, 1498, 1502, 1503, 1504, 1506, 1507, 1510, 1511, 1513, 1514, 1515, 1519, 1522, 1525, 1526, 1528, 1530, 1535, 1537, 1539, 1540, 1654, 1655, 1658, 1659, 1666, 1671, 1679, 1682, 1690, 1695, 1703, 1706, 1711, 1712, 1714, 1719, 1721, 1722, 1727, 1730, 1733, 1734, 1738, 1739, 1742, 1743, 1747, 1748,
+	82, 83, 87, 90, 94, 95, 99, 102, 103, 106, 107, 110, 182, 183, 186, 187, 314, 315, 318, 319, 328, 333, 343, 346, 352, 353, 356, 361, 363, 364, 366, 371, 374, 377, 378, 384, 385, 388, 389, 391, 394, 395, 488, 495, 502, 509, 511, 512, 540, 542, 543, 546, 667, 668, 671, 672, 681, 686, 695, 696, 699, 700, 703, 705, 706, 709, 710, 713, 714, 716, 717, 719, 720, 724, 727, 730, 731, 734, 737, 738, 741, 742, 744, 745, 747, 748, 891, 896, 903, 908, 915, 920, 927, 928, 931, 932, 939, 940, 943, 944, 946, 947, 948, 952, 955, 959, 960, 964, 967, 969, 970, 972, 976, 979, 981, 982, 1083, 1084, 1090, 1091, 1098, 1100, 1104, 1107, 1108, 1111, 1112, 1114, 1115, 1118, 1119, 1121, 1206, 1207, 1212, 1215, 1216, 1224, 1227, 1233, 1234, 1236, 1237, 1239, 1314, 1315, 1320, 1324, 1327, 1330, 1332, 1333, 1335, 1336, 1341, 1342, 1345, 1347, 1448, 1451, 1459, 1464, 1471, 1472, 1475, 1476, 1483, 1488, 1496, 1499, 1503, 1504, 1507, 1508, 1511, 1512, 1513, 1514, 1516, 1520, 1523, 1525, 1526, 1531, 1536, 1538, 1539, 1540, 1655, 1656, 1659, 1660, 1667, 1672, 1680, 1683, 1691, 1696, 1704, 1707, 1711, 1712, 1715, 1720, 1721, 1722, 1723, 1728, 1731, 1733, 1734, 1739, 1740, 1743, 1744, 1745, 1747, 1748,
+	83, 91, 95, 103, 107, 111, 183, 187, 315, 319, 329, 347, 353, 357, 364, 367, 375, 378, 385, 389, 392, 395, 489, 496, 503, 510, 512, 543, 668, 672, 682, 696, 700, 706, 710, 714, 717, 720, 728, 731, 738, 742, 745, 748, 892, 904, 916, 928, 932, 940, 944, 948, 956, 960, 968, 970, 980, 982, 1084, 1091, 1101, 1105, 1108, 1112, 1115, 1119, 1122, 1207, 1213, 1216, 1225, 1228, 1234, 1237, 1240, 1315, 1321, 1333, 1336, 1342, 1348, 1452, 1460, 1472, 1476, 1484, 1500, 1504, 1508, 1512, 1514, 1524, 1526, 1532, 1540, 1656, 1660, 1668, 1684, 1692, 1708, 1712, 1716, 1722, 1724, 1732, 1734, 1740, 1744, 1746, 1748,
+	96, 100, 108, 112, 116, 120, 184, 188, 340, 344, 358, 368, 376, 379, 386, 390, 396, 404, 407, 410, 414, 421, 492, 499, 506, 513, 518, 544, 693, 697, 711, 721, 725, 729, 732, 735, 739, 743, 749, 757, 760, 763, 767, 774, 917, 929, 941, 949, 953, 961, 965, 969, 973, 981, 985, 995, 997, 1007, 1095, 1102, 1109, 1113, 1120, 1123, 1127, 1130, 1134, 1217, 1220, 1226, 1229, 1232, 1241, 1244, 1247, 1328, 1334, 1337, 1340, 1349, 1355, 1469, 1485, 1493, 1497, 1509, 1517, 1527, 1529, 1533, 1537, 1541, 1549, 1557, 1563, 1677, 1681, 1693, 1701, 1717, 1725, 1733, 1735, 1741, 1745, 1749, 1757, 1759, 1761, 1765, 1771,
+	96, 97, 101, 104, 108, 109, 113, 116, 117, 120, 121, 124, 184, 185, 188, 189, 340, 341, 344, 345, 354, 359, 369, 372, 377, 379, 380, 382, 387, 390, 391, 397, 400, 404, 405, 408, 410, 411, 414, 415, 421, 422, 493, 500, 507, 514, 518, 519, 541, 544, 545, 547, 693, 694, 697, 698, 707, 712, 721, 722, 725, 726, 729, 730, 732, 733, 735, 736, 739, 740, 743, 744, 746, 750, 753, 757, 758, 760, 761, 763, 764, 767, 768, 771, 774, 775, 913, 918, 925, 930, 937, 942, 949, 950, 953, 954, 961, 962, 965, 966, 969, 970, 974, 977, 981, 982, 983, 986, 989, 995, 996, 998, 1001, 1005, 1007, 1008, 1095, 1096, 1102, 1103, 1110, 1114, 1116, 1120, 1121, 1123, 1124, 1127, 1128, 1130, 1131, 1135, 1217, 1218, 1221, 1226, 1227, 1230, 1233, 1242, 1244, 1245, 1247, 1248, 1325, 1329, 1334, 1335, 1337, 1338, 1340, 1341, 1343, 1346, 1350, 1352, 1355, 1356, 1470, 1473, 1481, 1486, 1493, 1494, 1497, 1498, 1505, 1510, 1518, 1521, 1525, 1527, 1528, 1529, 1530, 1533, 1534, 1537, 1538, 1542, 1545, 1549, 1550, 1551, 1553, 1558, 1563, 1564, 1677, 1678, 1681, 1682, 1689, 1694, 1702, 1705, 1713, 1718, 1726, 1729, 1734, 1735, 1736, 1737, 1742, 1745, 1746, 1750, 1753, 1757, 1758, 1760, 1761, 1762, 1765, 1766, 1771, 1772,
+	97, 98, 102, 105, 109, 110, 114, 117, 118, 121, 122, 125, 185, 186, 189, 190, 341, 342, 345, 346, 355, 360, 370, 373, 378, 379, 380, 381, 383, 388, 390, 391, 392, 393, 398, 401, 404, 405, 406, 409, 411, 412, 415, 416, 418, 421, 422, 423, 494, 501, 508, 515, 518, 519, 542, 544, 545, 546, 548, 694, 695, 698, 699, 708, 713, 722, 723, 726, 727, 730, 731, 732, 733, 734, 736, 737, 740, 741, 743, 744, 745, 746, 747, 751, 754, 757, 758, 759, 761, 762, 764, 765, 768, 769, 771, 772, 774, 775, 776, 914, 919, 926, 931, 938, 943, 950, 951, 954, 955, 962, 963, 966, 967, 969, 970, 971, 975, 978, 982, 983, 984, 987, 990, 993, 995, 996, 999, 1002, 1005, 1006, 1008, 1096, 1097, 1103, 1104, 1111, 1113, 1115, 1117, 1120, 1121, 1122, 1124, 1125, 1127, 1128, 1129, 1131, 1132, 1134, 1136, 1217, 1218, 1219, 1222, 1223, 1226, 1227, 1228, 1231, 1234, 1235, 1238, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1325, 1326, 1330, 1331, 1335, 1336, 1338, 1339, 1341, 1342, 1343, 1344, 1346, 1347, 1351, 1352, 1353, 1356, 1357, 1358, 1471, 1474, 1482, 1487, 1494, 1495, 1498, 1499, 1506, 1511, 1519, 1522, 1526, 1527, 1528, 1530, 1531, 1534, 1535, 1537, 1538, 1539, 1543, 1546, 1549, 1550, 1552, 1554, 1559, 1561, 1563, 1564, 1678, 1679, 1682, 1683, 1690, 1695, 1703, 1706, 1714, 1719, 1727, 1730, 1735, 1736, 1738, 1743, 1745, 1746, 1751, 1754, 1757, 1758, 1762, 1763, 1766, 1767, 1771, 1772,
+	98, 99, 103, 106, 110, 111, 115, 118, 119, 122, 123, 126, 186, 187, 190, 191, 342, 343, 346, 347, 356, 361, 371, 374, 380, 381, 384, 389, 391, 392, 394, 399, 402, 405, 406, 412, 413, 416, 417, 419, 422, 423, 495, 502, 509, 516, 518, 519, 543, 545, 546, 549, 695, 696, 699, 700, 709, 714, 723, 724, 727, 728, 731, 733, 734, 737, 738, 741, 742, 744, 745, 747, 748, 752, 755, 758, 759, 762, 765, 766, 769, 770, 772, 773, 775, 776, 915, 920, 927, 932, 939, 944, 951, 952, 955, 956, 963, 964, 967, 968, 970, 971, 972, 976, 979, 983, 984, 988, 991, 993, 994, 996, 1000, 1003, 1005, 1006, 1097, 1098, 1104, 1105, 1112, 1114, 1118, 1121, 1122, 1125, 1126, 1128, 1129, 1132, 1133, 1135, 1218, 1219, 1224, 1227, 1228, 1236, 1239, 1245, 1246, 1248, 1249, 1251, 1326, 1327, 1332, 1336, 1339, 1342, 1344, 1345, 1347, 1348, 1353, 1354, 1357, 1359, 1472, 1475, 1483, 1488, 1495, 1496, 1499, 1500, 1507, 1512, 1520, 1523, 1527, 1528, 1531, 1532, 1535, 1536, 1537, 1538, 1540, 1544, 1547, 1549, 1550, 1555, 1560, 1562, 1563, 1564, 1679, 1680, 1683, 1684, 1691, 1696, 1704, 1707, 1715, 1720, 1728, 1731, 1735, 1736, 1739, 1744, 1745, 1746, 1747, 1752, 1755, 1757, 1758, 1763, 1764, 1767, 1768, 1769, 1771, 1772,
+	99, 107, 111, 119, 123, 127, 187, 191, 343, 347, 357, 375, 381, 385, 392, 395, 403, 406, 413, 417, 420, 423, 496, 503, 510, 517, 519, 546, 696, 700, 710, 724, 728, 734, 738, 742, 745, 748, 756, 759, 766, 770, 773, 776, 916, 928, 940, 952, 956, 964, 968, 972, 980, 984, 992, 994, 1004, 1006, 1098, 1105, 1115, 1119, 1122, 1126, 1129, 1133, 1136, 1219, 1225, 1228, 1237, 1240, 1246, 1249, 1252, 1327, 1333, 1345, 1348, 1354, 1360, 1476, 1484, 1496, 1500, 1508, 1524, 1528, 1532, 1536, 1538, 1548, 1550, 1556, 1564, 1680, 1684, 1692, 1708, 1716, 1732, 1736, 1740, 1746, 1748, 1756, 1758, 1764, 1768, 1770, 1772,
+	112, 116, 124, 128, 132, 136, 188, 192, 368, 372, 386, 396, 404, 407, 414, 418, 424, 432, 435, 438, 442, 449, 499, 506, 513, 520, 547, 721, 725, 739, 749, 753, 757, 760, 763, 767, 771, 777, 785, 788, 791, 795, 802, 941, 953, 965, 973, 977, 985, 989, 993, 997, 1005, 1011, 1015, 1109, 1116, 1123, 1127, 1134, 1137, 1141, 1144, 1148, 1229, 1232, 1238, 1241, 1244, 1253, 1256, 1259, 1340, 1346, 1349, 1352, 1361, 1367, 1493, 1509, 1517, 1521, 1533, 1541, 1551, 1553, 1557, 1561, 1565, 1571, 1701, 1705, 1717, 1725, 1741, 1749, 1757, 1759, 1765, 1769, 1773, 1775, 1779,
+	112, 113, 117, 120, 124, 125, 129, 132, 133, 136, 137, 140, 188, 189, 192, 193, 368, 369, 372, 373, 382, 387, 397, 400, 405, 407, 408, 410, 415, 418, 419, 425, 428, 432, 433, 436, 438, 439, 442, 443, 449, 450, 500, 507, 514, 520, 521, 544, 547, 548, 550, 721, 722, 725, 726, 735, 740, 749, 750, 753, 754, 757, 758, 760, 761, 763, 764, 767, 768, 771, 772, 774, 778, 781, 785, 786, 788, 789, 791, 792, 795, 796, 799, 802, 803, 937, 942, 949, 954, 961, 966, 973, 974, 977, 978, 985, 986, 989, 990, 993, 994, 998, 1001, 1005, 1006, 1007, 1011, 1012, 1013, 1015, 1016, 1109, 1110, 1116, 1117, 1124, 1128, 1130, 1134, 1135, 1137, 1138, 1141, 1142, 1144, 1145, 1149, 1229, 1230, 1233, 1238, 1239, 1242, 1245, 1254, 1256, 1257, 1259, 1260, 1337, 1341, 1346, 1347, 1349, 1350, 1352, 1353, 1355, 1358, 1362, 1364, 1367, 1368, 1494, 1497, 1505, 1510, 1517, 1518, 1521, 1522, 1529, 1534, 1542, 1545, 1549, 1551, 1552, 1553, 1554, 1557, 1558, 1561, 1562, 1565, 1566, 1567, 1571, 1572, 1701, 1702, 1705, 1706, 1713, 1718, 1726, 1729, 1737, 1742, 1750, 1753, 1758, 1759, 1760, 1761, 1766, 1769, 1770, 1773, 1774, 1776, 1779, 1780,
+	113, 114, 118, 121, 125, 126, 130, 133, 134, 137, 138, 141, 189, 190, 193, 194, 369, 370, 373, 374, 383, 388, 398, 401, 406, 407, 408, 409, 411, 416, 418, 419, 420, 421, 426, 429, 432, 433, 434, 437, 439, 440, 443, 444, 446, 449, 450, 451, 501, 508, 515, 520, 521, 545, 547, 548, 549, 551, 722, 723, 726, 727, 736, 741, 750, 751, 754, 755, 758, 759, 760, 761, 762, 764, 765, 768, 769, 771, 772, 773, 774, 775, 779, 782, 785, 786, 787, 789, 790, 792, 793, 796, 797, 799, 800, 802, 803, 804, 938, 943, 950, 955, 962, 967, 974, 975, 978, 979, 986, 987, 990, 991, 993, 994, 995, 999, 1002, 1006, 1007, 1008, 1009, 1011, 1012, 1013, 1014, 1016, 1110, 1111, 1117, 1118, 1125, 1127, 1129, 1131, 1134, 1135, 1136, 1138, 1139, 1141, 1142, 1143, 1145, 1146, 1148, 1150, 1229, 1230, 1231, 1234, 1235, 1238, 1239, 1240, 1243, 1246, 1247, 1250, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1337, 1338, 1342, 1343, 1347, 1348, 1350, 1351, 1353, 1354, 1355, 1356, 1358, 1359, 1363, 1364, 1365, 1368, 1369, 1370, 1495, 1498, 1506, 1511, 1518, 1519, 1522, 1523, 1530, 1535, 1543, 1546, 1550, 1551, 1552, 1554, 1555, 1558, 1559, 1561, 1562, 1563, 1565, 1566, 1568, 1569, 1571, 1572, 1702, 1703, 1706, 1707, 1714, 1719, 1727, 1730, 1738, 1743, 1751, 1754, 1759, 1760, 1762, 1767, 1769, 1770, 1773, 1774, 1779, 1780,
+	114, 115, 119, 122, 126, 127, 131, 134, 135, 138, 139, 142, 190, 191, 194, 195, 370, 371, 374, 375, 384, 389, 399, 402, 408, 409, 412, 417, 419, 420, 422, 427, 430, 433, 434, 440, 441, 444, 445, 447, 450, 451, 502, 509, 516, 520, 521, 546, 548, 549, 552, 723, 724, 727, 728, 737, 742, 751, 752, 755, 756, 759, 761, 762, 765, 766, 769, 770, 772, 773, 775, 776, 780, 783, 786, 787, 790, 793, 794, 797, 798, 800, 801, 803, 804, 939, 944, 951, 956, 963, 968, 975, 976, 979, 980, 987, 988, 991, 992, 994, 995, 996, 1000, 1003, 1007, 1008, 1009, 1010, 1012, 1013, 1014, 1111, 1112, 1118, 1119, 1126, 1128, 1132, 1135, 1136, 1139, 1140, 1142, 1143, 1146, 1147, 1149, 1230, 1231, 1236, 1239, 1240, 1248, 1251, 1257, 1258, 1260, 1261, 1263, 1338, 1339, 1344, 1348, 1351, 1354, 1356, 1357, 1359, 1360, 1365, 1366, 1369, 1371, 1496, 1499, 1507, 1512, 1519, 1520, 1523, 1524, 1531, 1536, 1544, 1547, 1551, 1552, 1555, 1556, 1559, 1560, 1561, 1562, 1564, 1565, 1566, 1570, 1571, 1572, 1703, 1704, 1707, 1708, 1715, 1720, 1728, 1731, 1739, 1744, 1752, 1755, 1759, 1760, 1763, 1768, 1769, 1770, 1771, 1773, 1774, 1777, 1779, 1780,
+	115, 123, 127, 135, 139, 143, 191, 195, 371, 375, 385, 403, 409, 413, 420, 423, 431, 434, 441, 445, 448, 451, 503, 510, 517, 521, 549, 724, 728, 738, 752, 756, 762, 766, 770, 773, 776, 784, 787, 794, 798, 801, 804, 940, 952, 964, 976, 980, 988, 992, 996, 1004, 1008, 1010, 1014, 1112, 1119, 1129, 1133, 1136, 1140, 1143, 1147, 1150, 1231, 1237, 1240, 1249, 1252, 1258, 1261, 1264, 1339, 1345, 1357, 1360, 1366, 1372, 1500, 1508, 1520, 1524, 1532, 1548, 1552, 1556, 1560, 1562, 1566, 1572, 1704, 1708, 1716, 1732, 1740, 1756, 1760, 1764, 1770, 1772, 1774, 1778, 1780,
+	128, 132, 140, 144, 148, 152, 192, 196, 396, 400, 414, 424, 432, 435, 442, 446, 452, 455, 461, 506, 513, 522, 550, 749, 753, 767, 777, 781, 785, 788, 791, 795, 799, 805, 808, 814, 965, 977, 989, 997, 1001, 1009, 1013, 1019, 1023, 1123, 1130, 1137, 1141, 1148, 1151, 1154, 1241, 1244, 1250, 1253, 1256, 1352, 1358, 1361, 1364, 1517, 1533, 1541, 1545, 1557, 1567, 1569, 1573, 1579, 1725, 1729, 1741, 1749, 1765, 1773, 1775, 1777, 1781, 1783, 1787,
+	128, 129, 133, 136, 140, 141, 145, 148, 149, 152, 153, 156, 192, 193, 196, 197, 396, 397, 400, 401, 410, 415, 425, 428, 433, 435, 436, 438, 443, 446, 447, 452, 453, 456, 461, 462, 507, 514, 522, 523, 547, 550, 551, 749, 750, 753, 754, 763, 768, 777, 778, 781, 782, 785, 786, 788, 789, 791, 792, 795, 796, 799, 800, 802, 805, 806, 808, 809, 811, 814, 815, 961, 966, 973, 978, 985, 990, 997, 998, 1001, 1002, 1009, 1010, 1013, 1014, 1015, 1019, 1020, 1021, 1023, 1024, 1123, 1124, 1130, 1131, 1138, 1142, 1144, 1148, 1149, 1151, 1152, 1155, 1241, 1242, 1245, 1250, 1251, 1254, 1257, 1349, 1353, 1358, 1359, 1361, 1362, 1364, 1365, 1367, 1370, 1518, 1521, 1529, 1534, 1541, 1542, 1545, 1546, 1553, 1558, 1565, 1567, 1568, 1569, 1570, 1573, 1574, 1575, 1579, 1580, 1725, 1726, 1729, 1730, 1737, 1742, 1750, 1753, 1761, 1766, 1774, 1775, 1776, 1777, 1778, 1781, 1782, 1784, 1787, 1788,
+	129, 130, 134, 137, 141, 142, 146, 149, 150, 153, 154, 157, 193, 194, 197, 198, 397, 398, 401, 402, 411, 416, 426, 429, 434, 435, 436, 437, 439, 444, 446, 447, 448, 449, 452, 453, 454, 457, 458, 461, 462, 463, 508, 515, 522, 523, 548, 550, 551, 552, 750, 751, 754, 755, 764, 769, 778, 779, 782, 783, 786, 787, 788, 789, 790, 792, 793, 796, 797, 799, 800, 801, 802, 803, 805, 806, 807, 809, 810, 811, 812, 814, 815, 816, 962, 967, 974, 979, 986, 991, 998, 999, 1002, 1003, 1009, 1010, 1011, 1014, 1015, 1016, 1017, 1019, 1020, 1021, 1022, 1024, 1124, 1125, 1131, 1132, 1139, 1141, 1143, 1145, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1156, 1241, 1242, 1243, 1246, 1247, 1250, 1251, 1252, 1255, 1258, 1259, 1262, 1349, 1350, 1354, 1355, 1359, 1360, 1362, 1363, 1365, 1366, 1367, 1368, 1370, 1371, 1519, 1522, 1530, 1535, 1542, 1543, 1546, 1547, 1554, 1559, 1566, 1567, 1568, 1569, 1570, 1571, 1573, 1574, 1576, 1577, 1579, 1580, 1726, 1727, 1730, 1731, 1738, 1743, 1751, 1754, 1762, 1767, 1775, 1776, 1777, 1778, 1781, 1782, 1787, 1788,
+	130, 131, 135, 138, 142, 143, 147, 150, 151, 154, 155, 158, 194, 195, 198, 199, 398, 399, 402, 403, 412, 417, 427, 430, 436, 437, 440, 445, 447, 448, 450, 453, 454, 459, 462, 463, 509, 516, 522, 523, 549, 551, 552, 751, 752, 755, 756, 765, 770, 779, 780, 783, 784, 787, 789, 790, 793, 794, 797, 798, 800, 801, 803, 804, 806, 807, 810, 812, 813, 815, 816, 963, 968, 975, 980, 987, 992, 999, 1000, 1003, 1004, 1010, 1011, 1012, 1015, 1016, 1017, 1018, 1020, 1021, 1022, 1125, 1126, 1132, 1133, 1140, 1142, 1146, 1149, 1150, 1152, 1153, 1155, 1242, 1243, 1248, 1251, 1252, 1260, 1263, 1350, 1351, 1356, 1360, 1363, 1366, 1368, 1369, 1371, 1372, 1520, 1523, 1531, 1536, 1543, 1544, 1547, 1548, 1555, 1560, 1567, 1568, 1569, 1570, 1572, 1573, 1574, 1578, 1579, 1580, 1727, 1728, 1731, 1732, 1739, 1744, 1752, 1755, 1763, 1768, 1775, 1776, 1777, 1778, 1779, 1781, 1782, 1785, 1787, 1788,
+	131, 139, 143, 151, 155, 159, 195, 199, 399, 403, 413, 431, 437, 441, 448, 451, 454, 460, 463, 510, 517, 523, 552, 752, 756, 766, 780, 784, 790, 794, 798, 801, 804, 807, 813, 816, 964, 976, 988, 1000, 1004, 1012, 1016, 1018, 1022, 1126, 1133, 1143, 1147, 1150, 1153, 1156, 1243, 1249, 1252, 1261, 1264, 1351, 1357, 1369, 1372, 1524, 1532, 1544, 1548, 1556, 1568, 1570, 1574, 1580, 1728, 1732, 1740, 1756, 1764, 1776, 1778, 1780, 1782, 1786, 1788,
+	144, 148, 156, 196, 424, 428, 442, 452, 455, 458, 513, 524, 777, 781, 795, 805, 808, 811, 989, 1001, 1017, 1021, 1137, 1144, 1151, 1154, 1253, 1256, 1262, 1364, 1370, 1541, 1557, 1575, 1577, 1749, 1753, 1765, 1781, 1783, 1785,
+	144, 145, 149, 152, 156, 157, 196, 197, 424, 425, 428, 429, 438, 443, 453, 455, 456, 458, 459, 514, 524, 525, 550, 777, 778, 781, 782, 791, 796, 805, 806, 808, 809, 811, 812, 814, 985, 990, 997, 1002, 1017, 1018, 1021, 1022, 1023, 1137, 1138, 1144, 1145, 1152, 1154, 1155, 1253, 1254, 1257, 1262, 1263, 1361, 1365, 1370, 1371, 1542, 1545, 1553, 1558, 1573, 1575, 1576, 1577, 1578, 1749, 1750, 1753, 1754, 1761, 1766, 1782, 1783, 1784, 1785, 1786,
+	145, 146, 150, 153, 157, 158, 197, 198, 425, 426, 429, 430, 439, 444, 454, 455, 456, 457, 458, 459, 460, 461, 515, 524, 525, 551, 778, 779, 782, 783, 792, 797, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 986, 991, 998, 1003, 1017, 1018, 1019, 1022, 1023, 1024, 1138, 1139, 1145, 1146, 1151, 1153, 1154, 1155, 1156, 1253, 1254, 1255, 1258, 1259, 1262, 1263, 1264, 1361, 1362, 1366, 1367, 1371, 1372, 1543, 1546, 1554, 1559, 1574, 1575, 1576, 1577, 1578, 1579, 1750, 1751, 1754, 1755, 1762, 1767, 1783, 1784, 1785, 1786,
+	146, 147, 151, 154, 158, 159, 198, 199, 426, 427, 430, 431, 440, 445, 456, 457, 459, 460, 462, 516, 524, 525, 552, 779, 780, 783, 784, 793, 798, 807, 809, 810, 812, 813, 815, 816, 987, 992, 999, 1004, 1018, 1019, 1020, 1023, 1024, 1139, 1140, 1146, 1147, 1152, 1155, 1156, 1254, 1255, 1260, 1263, 1264, 1362, 1363, 1368, 1372, 1544, 1547, 1555, 1560, 1575, 1576, 1577, 1578, 1580, 1751, 1752, 1755, 1756, 1763, 1768, 1783, 1784, 1785, 1786, 1787,
+	147, 155, 159, 199, 427, 431, 441, 457, 460, 463, 517, 525, 780, 784, 794, 810, 813, 816, 988, 1000, 1020, 1024, 1140, 1147, 1153, 1156, 1255, 1261, 1264, 1363, 1369, 1548, 1556, 1576, 1578, 1752, 1756, 1764, 1784, 1786, 1788,
+};
+
+static const short first_covering[BOARD_HEIGHT*BOARD_WIDTH + 1] = {
+	0, 41, 122, 217, 298,
+	339, 420, 580, 768, 928,
+	1009, 1112, 1315, 1551, 1754,
+	1857, 1968, 2186, 2437, 2655,
+	2766, 2877, 3095, 3346, 3564,
+	3675, 3786, 4004, 4255, 4473,
+	4584, 4695, 4913, 5164, 5382,
+	5493, 5604, 5822, 6073, 6291,
+	6402, 6505, 6708, 6944, 7147,
+	7250, 7331, 7491, 7679, 7839,
+	7920, 7961, 8042, 8137, 8218,
+	8259,
+};
+
+/**
+ * Placements whose first site is s are placements[anchored_placements[k]] for k from first_anchored[s]
+ * up to (excluding) first_anchored[s+1].
+ */
+static const short anchored_placements[] = {
+	0, 4, 8, 160, 200, 208, 211, 214, 218, 225, 464, 469, 553, 561, 564, 567, 571, 578, 817, 827, 829, 839, 1025, 1029, 1032, 1036, 1157, 1160, 1163, 1265, 1271, 1373, 1381, 1389, 1395, 1581, 1589, 1591, 1593, 1597, 1603,
+	1, 5, 9, 12, 161, 201, 204, 209, 212, 215, 219, 226, 465, 470, 526, 554, 557, 562, 565, 568, 572, 575, 579, 818, 821, 828, 830, 833, 837, 840, 1026, 1030, 1033, 1037, 1158, 1161, 1164, 1266, 1268, 1272, 1374, 1377, 1382, 1383, 1385, 1390, 1396, 1582, 1585, 1590, 1592, 1594, 1598, 1604,
+	2, 6, 10, 13, 162, 202, 205, 210, 213, 216, 220, 222, 227, 466, 527, 555, 558, 563, 566, 569, 573, 576, 580, 819, 822, 825, 831, 834, 838, 1027, 1031, 1034, 1038, 1159, 1162, 1165, 1166, 1267, 1269, 1273, 1274, 1375, 1378, 1384, 1386, 1391, 1393, 1583, 1586, 1595, 1599,
+	3, 7, 11, 14, 163, 203, 206, 217, 221, 223, 467, 528, 556, 559, 570, 574, 577, 820, 823, 826, 832, 835, 1028, 1035, 1167, 1270, 1275, 1376, 1379, 1387, 1392, 1394, 1584, 1587, 1596, 1600, 1601,
+	15, 207, 224, 468, 560, 824, 836, 1168, 1276, 1380, 1388, 1588, 1602,
+	16, 20, 24, 164, 228, 236, 239, 242, 246, 253, 471, 476, 581, 589, 592, 595, 599, 606, 841, 851, 853, 863, 1039, 1043, 1046, 1050, 1169, 1172, 1175, 1277, 1283, 1397, 1405, 1413, 1419, 1605, 1613, 1615, 1617, 1621, 1627,
+	17, 21, 25, 28, 165, 229, 232, 237, 240, 243, 247, 254, 472, 477, 529, 582, 585, 590, 593, 596, 600, 603, 607, 842, 845, 852, 854, 857, 861, 864, 1040, 1044, 1047, 1051, 1170, 1173, 1176, 1278, 1280, 1284, 1398, 1401, 1406, 1407, 1409, 1414, 1420, 1606, 1609, 1614, 1616, 1618, 1622, 1628,
+	18, 22, 26, 29, 166, 230, 233, 238, 241, 244, 248, 250, 255, 473, 530, 583, 586, 591, 594, 597, 601, 604, 608, 843, 846, 849, 855, 858, 862, 1041, 1045, 1048, 1052, 1171, 1174, 1177, 1178, 1279, 1281, 1285, 1286, 1399, 1402, 1408, 1410, 1415, 1417, 1607, 1610, 1619, 1623,
+	19, 23, 27, 30, 167, 231, 234, 245, 249, 251, 474, 531, 584, 587, 598, 602, 605, 844, 847, 850, 856, 859, 1042, 1049, 1179, 1282, 1287, 1400, 1403, 1411, 1416, 1418, 1608, 1611, 1620, 1624, 1625,
+	31, 235, 252, 475, 588, 848, 860, 1180, 1288, 1404, 1412, 1612, 1626,
+	32, 36, 40, 168, 256, 264, 267, 270, 274, 281, 478, 483, 609, 617, 620, 623, 627, 634, 865, 875, 877, 887, 1053, 1057, 1060, 1064, 1181, 1184, 1187, 1289, 1295, 1421, 1429, 1437, 1443, 1629, 1637, 1639, 1641, 1645, 1651,
+	33, 37, 41, 44, 169, 257, 260, 265, 268, 271, 275, 282, 479, 484, 532, 610, 613, 618, 621, 624, 628, 631, 635, 866, 869, 876, 878, 881, 885, 888, 1054, 1058, 1061, 1065, 1182, 1185, 1188, 1290, 1292, 1296, 1422, 1425, 1430, 1431, 1433, 1438, 1444, 1630, 1633, 1638, 1640, 1642, 1646, 1652,
+	34, 38, 42, 45, 170, 258, 261, 266, 269, 272, 276, 278, 283, 480, 533, 611, 614, 619, 622, 625, 629, 632, 636, 867, 870, 873, 879, 882, 886, 1055, 1059, 1062, 1066, 1183, 1186, 1189, 1190, 1291, 1293, 1297, 1298, 1423, 1426, 1432, 1434, 1439, 1441, 1631, 1634, 1643, 1647,
+	35, 39, 43, 46, 171, 259, 262, 273, 277, 279, 481, 534, 612, 615, 626, 630, 633, 868, 871, 874, 880, 883, 1056, 1063, 1191, 1294, 1299, 1424, 1427, 1435, 1440, 1442, 1632, 1635, 1644, 1648, 1649,
+	47, 263, 280, 482, 616, 872, 884, 1192, 1300, 1428, 1436, 1636, 1650,
+	48, 52, 56, 172, 284, 292, 295, 298, 302, 309, 485, 490, 637, 645, 648, 651, 655, 662, 889, 899, 901, 911, 1067, 1071, 1074, 1078, 1193, 1196, 1199, 1301, 1307, 1445, 1453, 1461, 1467, 1653, 1661, 1663, 1665, 1669, 1675,
+	49, 53, 57, 60, 173, 285, 288, 293, 296, 299, 303, 310, 486, 491, 535, 638, 641, 646, 649, 652, 656, 659, 663, 890, 893, 900, 902, 905, 909, 912, 1068, 1072, 1075, 1079, 1194, 1197, 1200, 1302, 1304, 1308, 1446, 1449, 1454, 1455, 1457, 1462, 1468, 1654, 1657, 1662, 1664, 1666, 1670, 1676,
+	50, 54, 58, 61, 174, 286, 289, 294, 297, 300, 304, 306, 311, 487, 536, 639, 642, 647, 650, 653, 657, 660, 664, 891, 894, 897, 903, 906, 910, 1069, 1073, 1076, 1080, 1195, 1198, 1201, 1202, 1303, 1305, 1309, 1310, 1447, 1450, 1456, 1458, 1463, 1465, 1655, 1658, 1667, 1671,
+	51, 55, 59, 62, 175, 287, 290, 301, 305, 307, 488, 537, 640, 643, 654, 658, 661, 892, 895, 898, 904, 907, 1070, 1077, 1203, 1306, 1311, 1448, 1451, 1459, 1464, 1466, 1656, 1659, 1668, 1672, 1673,
+	63, 291, 308, 489, 644, 896, 908, 1204, 1312, 1452, 1460, 1660, 1674,
+	64, 68, 72, 176, 312, 320, 323, 326, 330, 337, 492, 497, 665, 673, 676, 679, 683, 690, 913, 923, 925, 935, 1081, 1085, 1088, 1092, 1205, 1208, 1211, 1313, 1319, 1469, 1477, 1485, 1491, 1677, 1685, 1687, 1689, 1693, 1699,
+	65, 69, 73, 76, 177, 313, 316, 321, 324, 327, 331, 338, 493, 498, 538, 666, 669, 674, 677, 680, 684, 687, 691, 914, 917, 924, 926, 929, 933, 936, 1082, 1086, 1089, 1093, 1206, 1209, 1212, 1314, 1316, 1320, 1470, 1473, 1478, 1479, 1481, 1486, 1492, 1678, 1681, 1686, 1688, 1690, 1694, 1700,
+	66, 70, 74, 77, 178, 314, 317, 322, 325, 328, 332, 334, 339, 494, 539, 667, 670, 675, 678, 681, 685, 688, 692, 915, 918, 921, 927, 930, 934, 1083, 1087, 1090, 1094, 1207, 1210, 1213, 1214, 1315, 1317, 1321, 1322, 1471, 1474, 1480, 1482, 1487, 1489, 1679, 1682, 1691, 1695,
+	67, 71, 75, 78, 179, 315, 318, 329, 333, 335, 495, 540, 668, 671, 682, 686, 689, 916, 919, 922, 928, 931, 1084, 1091, 1215, 1318, 1323, 1472, 1475, 1483, 1488, 1490, 1680, 1683, 1692, 1696, 1697,
+	79, 319, 336, 496, 672, 920, 932, 1216, 1324, 1476, 1484, 1684, 1698,
+	80, 84, 88, 180, 340, 348, 351, 354, 358, 365, 499, 504, 693, 701, 704, 707, 711, 718, 937, 947, 949, 959, 1095, 1099, 1102, 1106, 1217, 1220, 1223, 1325, 1331, 1493, 1501, 1509, 1515, 1701, 1709, 1711, 1713, 1717, 1723,
+	81, 85, 89, 92, 181, 341, 344, 349, 352, 355, 359, 366, 500, 505, 541, 694, 697, 702, 705, 708, 712, 715, 719, 938, 941, 948, 950, 953, 957, 960, 1096, 1100, 1103, 1107, 1218, 1221, 1224, 1326, 1328, 1332, 1494, 1497, 1502, 1503, 1505, 1510, 1516, 1702, 1705, 1710, 1712, 1714, 1718, 1724,
+	82, 86, 90, 93, 182, 342, 345, 350, 353, 356, 360, 362, 367, 501, 542, 695, 698, 703, 706, 709, 713, 716, 720, 939, 942, 945, 951, 954, 958, 1097, 1101, 1104, 1108, 1219, 1222, 1225, 1226, 1327, 1329, 1333, 1334, 1495, 1498, 1504, 1506, 1511, 1513, 1703, 1706, 1715, 1719,
+	83, 87, 91, 94, 183, 343, 346, 357, 361, 363, 502, 543, 696, 699, 710, 714, 717, 940, 943, 946, 952, 955, 1098, 1105, 1227, 1330, 1335, 1496, 1499, 1507, 1512, 1514, 1704, 1707, 1716, 1720, 1721,
+	95, 347, 364, 503, 700, 944, 956, 1228, 1336, 1500, 1508, 1708, 1722,
+	96, 100, 104, 184, 368, 376, 379, 382, 386, 393, 506, 511, 721, 729, 732, 735, 739, 746, 961, 971, 973, 983, 1109, 1113, 1116, 1120, 1229, 1232, 1235, 1337, 1343, 1517, 1525, 1533, 1539, 1725, 1733, 1735, 1737, 1741, 1747,
+	97, 101, 105, 108, 185, 369, 372, 377, 380, 383, 387, 394, 507, 512, 544, 722, 725, 730, 733, 736, 740, 743, 747, 962, 965, 972, 974, 977, 981, 984, 1110, 1114, 1117, 1121, 1230, 1233, 1236, 1338, 1340, 1344, 1518, 1521, 1526, 1527, 1529, 1534, 1540, 1726, 1729, 1734, 1736, 1738, 1742, 1748,
+	98, 102, 106, 109, 186, 370, 373, 378, 381, 384, 388, 390, 395, 508, 545, 723, 726, 731, 734, 737, 741, 744, 748, 963, 966, 969, 975, 978, 982, 1111, 1115, 1118, 1122, 1231, 1234, 1237, 1238, 1339, 1341, 1345, 1346, 1519, 1522, 1528, 1530, 1535, 1537, 1727, 1730, 1739, 1743,
+	99, 103, 107, 110, 187, 371, 374, 385, 389, 391, 509, 546, 724, 727, 738, 742, 745, 964, 967, 970, 976, 979, 1112, 1119, 1239, 1342, 1347, 1520, 1523, 1531, 1536, 1538, 1728, 1731, 1740, 1744, 1745,
+	111, 375, 392, 510, 728, 968, 980, 1240, 1348, 1524, 1532, 1732, 1746,
+	112, 116, 120, 188, 396, 404, 407, 410, 414, 421, 513, 518, 749, 757, 760, 763, 767, 774, 985, 995, 997, 1007, 1123, 1127, 1130, 1134, 1241, 1244, 1247, 1349, 1355, 1541, 1549, 1557, 1563, 1749, 1757, 1759, 1761, 1765, 1771,
+	113, 117, 121, 124, 189, 397, 400, 405, 408, 411, 415, 422, 514, 519, 547, 750, 753, 758, 761, 764, 768, 771, 775, 986, 989, 996, 998, 1001, 1005, 1008, 1124, 1128, 1131, 1135, 1242, 1245, 1248, 1350, 1352, 1356, 1542, 1545, 1550, 1551, 1553, 1558, 1564, 1750, 1753, 1758, 1760, 1762, 1766, 1772,
+	114, 118, 122, 125, 190, 398, 401, 406, 409, 412, 416, 418, 423, 515, 548, 751, 754, 759, 762, 765, 769, 772, 776, 987, 990, 993, 999, 1002, 1006, 1125, 1129, 1132, 1136, 1243, 1246, 1249, 1250, 1351, 1353, 1357, 1358, 1543, 1546, 1552, 1554, 1559, 1561, 1751, 1754, 1763, 1767,
+	115, 119, 123, 126, 191, 399, 402, 413, 417, 419, 516, 549, 752, 755, 766, 770, 773, 988, 991, 994, 1000, 1003, 1126, 1133, 1251, 1354, 1359, 1544, 1547, 1555, 1560, 1562, 1752, 1755, 1764, 1768, 1769,
+	127, 403, 420, 517, 756, 992, 1004, 1252, 1360, 1548, 1556, 1756, 1770,
+	128, 132, 136, 192, 424, 432, 435, 438, 442, 449, 520, 777, 785, 788, 791, 795, 802, 1011, 1015, 1137, 1141, 1144, 1148, 1253, 1256, 1259, 1361, 1367, 1565, 1571, 1773, 1775, 1779,
+	129, 133, 137, 140, 193, 425, 428, 433, 436, 439, 443, 450, 521, 550, 778, 781, 786, 789, 792, 796, 799, 803, 1012, 1013, 1016, 1138, 1142, 1145, 1149, 1254, 1257, 1260, 1362, 1364, 1368, 1566, 1567, 1572, 1774, 1776, 1780,
+	130, 134, 138, 141, 194, 426, 429, 434, 437, 440, 444, 446, 451, 551, 779, 782, 787, 790, 793, 797, 800, 804, 1009, 1014, 1139, 1143, 1146, 1150, 1255, 1258, 1261, 1262, 1363, 1365, 1369, 1370, 1568, 1569,
+	131, 135, 139, 142, 195, 427, 430, 441, 445, 447, 552, 780, 783, 794, 798, 801, 1010, 1140, 1147, 1263, 1366, 1371, 1570, 1777,
+	143, 431, 448, 784, 1264, 1372, 1778,
+	144, 148, 152, 196, 452, 455, 461, 522, 805, 808, 814, 1019, 1023, 1151, 1154, 1573, 1579, 1781, 1783, 1787,
+	145, 149, 153, 156, 197, 453, 456, 462, 523, 806, 809, 811, 815, 1020, 1021, 1024, 1152, 1155, 1574, 1575, 1580, 1782, 1784, 1788,
+	146, 150, 154, 157, 198, 454, 457, 458, 463, 807, 810, 812, 816, 1017, 1022, 1153, 1156, 1576, 1577,
+	147, 151, 155, 158, 199, 459, 813, 1018, 1578, 1785,
+	159, 460, 1786,
+	524,
+	525,
+	
+	
+	
+};
+
+static const short first_anchored[BOARD_HEIGHT*BOARD_WIDTH + 1] = {
+	0, 41, 95, 146, 183,
+	196, 237, 291, 342, 379,
+	392, 433, 487, 538, 575,
+	588, 629, 683, 734, 771,
+	784, 825, 879, 930, 967,
+	980, 1021, 1075, 1126, 1163,
+	1176, 1217, 1271, 1322, 1359,
+	1372, 1413, 1467, 1518, 1555,
+	1568, 1601, 1642, 1680, 1704,
+	1711, 1731, 1755, 1774, 1784,
+	1787, 1788, 1789, 1789, 1789,
+	1789,
+};
+
+/**
+ * Images of placement k under the symmetries of the board: symmetric_placements[k][0]: mirrored on the vertical axis,
+ * [1]: mirrored on the horizontal axis, [2]: rotated by 180 degrees.
+ */
+static const short symmetric_placements[NPLACEMENTS][3] = {
+	{15, 148, 155},
+	{14, 149, 154},
+	{13, 150, 153},
+	{12, 151, 152},
+	{11, 144, 159},
+	{10, 145, 158},
+	{9, 146, 157},
+	{8, 147, 156},
+	{7, 156, 147},
+	{6, 157, 146},
+	{5, 158, 145},
+	{4, 159, 144},
+	{3, 152, 151},
+	{2, 153, 150},
+	{1, 154, 149},
+	{0, 155, 148},
+	{31, 132, 139},
+	{30, 133, 138},
+	{29, 134, 137},
+	{28, 135, 136},
+	{27, 128, 143},
+	{26, 129, 142},
+	{25, 130, 141},
+	{24, 131, 140},
+	{23, 140, 131},
+	{22, 141, 130},
+	{21, 142, 129},
+	{20, 143, 128},
+	{19, 136, 135},
+	{18, 137, 134},
+	{17, 138, 133},
+	{16, 139, 132},
+	{47, 116, 123},
+	{46, 117, 122},
+	{45, 118, 121},
+	{44, 119, 120},
+	{43, 112, 127},
+	{42, 113, 126},
+	{41, 114, 125},
+	{40, 115, 124},
+	{39, 124, 115},
+	{38, 125, 114},
+	{37, 126, 113},
+	{36, 127, 112},
+	{35, 120, 119},
+	{34, 121, 118},
+	{33, 122, 117},
+	{32, 123, 116},
+	{63, 100, 107},
+	{62, 101, 106},
+	{61, 102, 105},
+	{60, 103, 104},
+	{59, 96, 111},
+	{58, 97, 110},
+	{57, 98, 109},
+	{56, 99, 108},
+	{55, 108, 99},
+	{54, 109, 98},
+	{53, 110, 97},
+	{52, 111, 96},
+	{51, 104, 103},
+	{50, 105, 102},
+	{49, 106, 101},
+	{48, 107, 100},
+	{79, 84, 91},
+	{78, 85, 90},
+	{77, 86, 89},
+	{76, 87, 88},
+	{75, 80, 95},
+	{74, 81, 94},
+	{73, 82, 93},
+	{72, 83, 92},
+	{71, 92, 83},
+	{70, 93, 82},
+	{69, 94, 81},
+	{68, 95, 80},
+	{67, 88, 87},
+	{66, 89, 86},
+	{65, 90, 85},
+	{64, 91, 84},
+	{95, 68, 75},
+	{94, 69, 74},
+	{93, 70, 73},
+	{92, 71, 72},
+	{91, 64, 79},
+	{90, 65, 78},
+	{89, 66, 77},
+	{88, 67, 76},
+	{87, 76, 67},
+	{86, 77, 66},
+	{85, 78, 65},
+	{84, 79, 64},
+	{83, 72, 71},
+	{82, 73, 70},
+	{81, 74, 69},
+	{80, 75, 68},
+	{111, 52, 59},
+	{110, 53, 58},
+	{109, 54, 57},
+	{108, 55, 56},
+	{107, 48, 63},
+	{106, 49, 62},
+	{105, 50, 61},
+	{104, 51, 60},
+	{103, 60, 51},
+	{102, 61, 50},
+	{101, 62, 49},
+	{100, 63, 48},
+	{99, 56, 55},
+	{98, 57, 54},
+	{97, 58, 53},
+	{96, 59, 52},
+	{127, 36, 43},
+	{126, 37, 42},
+	{125, 38, 41},
+	{124, 39, 40},
+	{123, 32, 47},
+	{122, 33, 46},
+	{121, 34, 45},
+	{120, 35, 44},
+	{119, 44, 35},
+	{118, 45, 34},
+	{117, 46, 33},
+	{116, 47, 32},
+	{115, 40, 39},
+	{114, 41, 38},
+	{113, 42, 37},
+	{112, 43, 36},
+	{143, 20, 27},
+	{142, 21, 26},
+	{141, 22, 25},
+	{140, 23, 24},
+	{139, 16, 31},
+	{138, 17, 30},
+	{137, 18, 29},
+	{136, 19, 28},
+	{135, 28, 19},
+	{134, 29, 18},
+	{133, 30, 17},
+	{132, 31, 16},
+	{131, 24, 23},
+	{130, 25, 22},
+	{129, 26, 21},
+	{128, 27, 20},
+	{159, 4, 11},
+	{158, 5, 10},
+	{157, 6, 9},
+	{156, 7, 8},
+	{155, 0, 15},
+	{154, 1, 14},
+	{153, 2, 13},
+	{152, 3, 12},
+	{151, 12, 3},
+	{150, 13, 2},
+	{149, 14, 1},
+	{148, 15, 0},
+	{147, 8, 7},
+	{146, 9, 6},
+	{145, 10, 5},
+	{144, 11, 4},
+	{163, 196, 199},
+	{162, 197, 198},
+	{161, 198, 197},
+	{160, 199, 196},
+	{167, 192, 195},
+	{166, 193, 194},
+	{165, 194, 193},
+	{164, 195, 192},
+	{171, 188, 191},
+	{170, 189, 190},
+	{169, 190, 189},
+	{168, 191, 188},
+	{175, 184, 187},
+	{174, 185, 186},
+	{173, 186, 185},
+	{172, 187, 184},
+	{179, 180, 183},
+	{178, 181, 182},
+	{177, 182, 181},
+	{176, 183, 180},
+	{183, 176, 179},
+	{182, 177, 178},
+	{181, 178, 177},
+	{180, 179, 176},
+	{187, 172, 175},
+	{186, 173, 174},
+	{185, 174, 173},
+	{184, 175, 172},
+	{191, 168, 171},
+	{190, 169, 170},
+	{189, 170, 169},
+	{188, 171, 168},
+	{195, 164, 167},
+	{194, 165, 166},
+	{193, 166, 165},
+	{192, 167, 164},
+	{199, 160, 163},
+	{198, 161, 162},
+	{197, 162, 161},
+	{196, 163, 160},
+	{207, 442, 441},
+	{206, 443, 440},
+	{205, 444, 439},
+	{204, 445, 438},
+	{203, 438, 445},
+	{202, 439, 444},
+	{201, 440, 443},
+	{200, 441, 442},
+	{227, 455, 460},
+	{226, 456, 459},
+	{225, 457, 458},
+	{224, 452, 463},
+	{223, 453, 462},
+	{222, 454, 461},
+	{221, 428, 427},
+	{220, 429, 426},
+	{219, 430, 425},
+	{218, 431, 424},
+	{217, 424, 431},
+	{216, 425, 430},
+	{215, 426, 429},
+	{214, 427, 428},
+	{213, 461, 454},
+	{212, 462, 453},
+	{211, 463, 452},
+	{210, 458, 457},
+	{209, 459, 456},
+	{208, 460, 455},
+	{235, 414, 413},
+	{234, 415, 412},
+	{233, 416, 411},
+	{232, 417, 410},
+	{231, 410, 417},
+	{230, 411, 416},
+	{229, 412, 415},
+	{228, 413, 414},
+	{255, 435, 448},
+	{254, 436, 447},
+	{253, 437, 446},
+	{252, 432, 451},
+	{251, 433, 450},
+	{250, 434, 449},
+	{249, 400, 399},
+	{248, 401, 398},
+	{247, 402, 397},
+	{246, 403, 396},
+	{245, 396, 403},
+	{244, 397, 402},
+	{243, 398, 401},
+	{242, 399, 400},
+	{241, 449, 434},
+	{240, 450, 433},
+	{239, 451, 432},
+	{238, 446, 437},
+	{237, 447, 436},
+	{236, 448, 435},
+	{263, 386, 385},
+	{262, 387, 384},
+	{261, 388, 383},
+	{260, 389, 382},
+	{259, 382, 389},
+	{258, 383, 388},
+	{257, 384, 387},
+	{256, 385, 386},
+	{283, 407, 420},
+	{282, 408, 419},
+	{281, 409, 418},
+	{280, 404, 423},
+	{279, 405, 422},
+	{278, 406, 421},
+	{277, 372, 371},
+	{276, 373, 370},
+	{275, 374, 369},
+	{274, 375, 368},
+	{273, 368, 375},
+	{272, 369, 374},
+	{271, 370, 373},
+	{270, 371, 372},
+	{269, 421, 406},
+	{268, 422, 405},
+	{267, 423, 404},
+	{266, 418, 409},
+	{265, 419, 408},
+	{264, 420, 407},
+	{291, 358, 357},
+	{290, 359, 356},
+	{289, 360, 355},
+	{288, 361, 354},
+	{287, 354, 361},
+	{286, 355, 360},
+	{285, 356, 359},
+	{284, 357, 358},
+	{311, 379, 392},
+	{310, 380, 391},
+	{309, 381, 390},
+	{308, 376, 395},
+	{307, 377, 394},
+	{306, 378, 393},
+	{305, 344, 343},
+	{304, 345, 342},
+	{303, 346, 341},
+	{302, 347, 340},
+	{301, 340, 347},
+	{300, 341, 346},
+	{299, 342, 345},
+	{298, 343, 344},
+	{297, 393, 378},
+	{296, 394, 377},
+	{295, 395, 376},
+	{294, 390, 381},
+	{293, 391, 380},
+	{292, 392, 379},
+	{319, 330, 329},
+	{318, 331, 328},
+	{317, 332, 327},
+	{316, 333, 326},
+	{315, 326, 333},
+	{314, 327, 332},
+	{313, 328, 331},
+	{312, 329, 330},
+	{339, 351, 364},
+	{338, 352, 363},
+	{337, 353, 362},
+	{336, 348, 367},
+	{335, 349, 366},
+	{334, 350, 365},
+	{333, 316, 315},
+	{332, 317, 314},
+	{331, 318, 313},
+	{330, 319, 312},
+	{329, 312, 319},
+	{328, 313, 318},
+	{327, 314, 317},
+	{326, 315, 316},
+	{325, 365, 350},
+	{324, 366, 349},
+	{323, 367, 348},
+	{322, 362, 353},
+	{321, 363, 352},
+	{320, 364, 351},
+	{347, 302, 301},
+	{346, 303, 300},
+	{345, 304, 299},
+	{344, 305, 298},
+	{343, 298, 305},
+	{342, 299, 304},
+	{341, 300, 303},
+	{340, 301, 302},
+	{367, 323, 336},
+	{366, 324, 335},
+	{365, 325, 334},
+	{364, 320, 339},
+	{363, 321, 338},
+	{362, 322, 337},
+	{361, 288, 287},
+	{360, 289, 286},
+	{359, 290, 285},
+	{358, 291, 284},
+	{357, 284, 291},
+	{356, 285, 290},
+	{355, 286, 289},
+	{354, 287, 288},
+	{353, 337, 322},
+	{352, 338, 321},
+	{351, 339, 320},
+	{350, 334, 325},
+	{349, 335, 324},
+	{348, 336, 323},
+	{375, 274, 273},
+	{374, 275, 272},
+	{373, 276, 271},
+	{372, 277, 270},
+	{371, 270, 277},
+	{370, 271, 276},
+	{369, 272, 275},
+	{368, 273, 274},
+	{395, 295, 308},
+	{394, 296, 307},
+	{393, 297, 306},
+	{392, 292, 311},
+	{391, 293, 310},
+	{390, 294, 309},
+	{389, 260, 259},
+	{388, 261, 258},
+	{387, 262, 257},
+	{386, 263, 256},
+	{385, 256, 263},
+	{384, 257, 262},
+	{383, 258, 261},
+	{382, 259, 260},
+	{381, 309, 294},
+	{380, 310, 293},
+	{379, 311, 292},
+	{378, 306, 297},
+	{377, 307, 296},
+	{376, 308, 295},
+	{403, 246, 245},
+	{402, 247, 244},
+	{401, 248, 243},
+	{400, 249, 242},
+	{399, 242, 249},
+	{398, 243, 248},
+	{397, 244, 247},
+	{396, 245, 246},
+	{423, 267, 280},
+	{422, 268, 279},
+	{421, 269, 278},
+	{420, 264, 283},
+	{419, 265, 282},
+	{418, 266, 281},
+	{417, 232, 231},
+	{416, 233, 230},
+	{415, 234, 229},
+	{414, 235, 228},
+	{413, 228, 235},
+	{412, 229, 234},
+	{411, 230, 233},
+	{410, 231, 232},
+	{409, 281, 266},
+	{408, 282, 265},
+	{407, 283, 264},
+	{406, 278, 269},
+	{405, 279, 268},
+	{404, 280, 267},
+	{431, 218, 217},
+	{430, 219, 216},
+	{429, 220, 215},
+	{428, 221, 214},
+	{427, 214, 221},
+	{426, 215, 220},
+	{425, 216, 219},
+	{424, 217, 218},
+	{451, 239, 252},
+	{450, 240, 251},
+	{449, 241, 250},
+	{448, 236, 255},
+	{447, 237, 254},
+	{446, 238, 253},
+	{445, 204, 203},
+	{444, 205, 202},
+	{443, 206, 201},
+	{442, 207, 200},
+	{441, 200, 207},
+	{440, 201, 206},
+	{439, 202, 205},
+	{438, 203, 204},
+	{437, 253, 238},
+	{436, 254, 237},
+	{435, 255, 236},
+	{434, 250, 241},
+	{433, 251, 240},
+	{432, 252, 239},
+	{463, 211, 224},
+	{462, 212, 223},
+	{461, 213, 222},
+	{460, 208, 227},
+	{459, 209, 226},
+	{458, 210, 225},
+	{457, 225, 210},
+	{456, 226, 209},
+	{455, 227, 208},
+	{454, 222, 213},
+	{453, 223, 212},
+	{452, 224, 211},
+	{468, 513, 517},
+	{467, 514, 516},
+	{466, 515, 515},
+	{465, 516, 514},
+	{464, 517, 513},
+	{470, 524, 525},
+	{469, 525, 524},
+	{475, 506, 510},
+	{474, 507, 509},
+	{473, 508, 508},
+	{472, 509, 507},
+	{471, 510, 506},
+	{477, 522, 523},
+	{476, 523, 522},
+	{482, 499, 503},
+	{481, 500, 502},
+	{480, 501, 501},
+	{479, 502, 500},
+	{478, 503, 499},
+	{484, 520, 521},
+	{483, 521, 520},
+	{489, 492, 496},
+	{488, 493, 495},
+	{487, 494, 494},
+	{486, 495, 493},
+	{485, 496, 492},
+	{491, 518, 519},
+	{490, 519, 518},
+	{496, 485, 489},
+	{495, 486, 488},
+	{494, 487, 487},
+	{493, 488, 486},
+	{492, 489, 485},
+	{498, 511, 512},
+	{497, 512, 511},
+	{503, 478, 482},
+	{502, 479, 481},
+	{501, 480, 480},
+	{500, 481, 479},
+	{499, 482, 478},
+	{505, 504, 505},
+	{504, 505, 504},
+	{510, 471, 475},
+	{509, 472, 474},
+	{508, 473, 473},
+	{507, 474, 472},
+	{506, 475, 471},
+	{512, 497, 498},
+	{511, 498, 497},
+	{517, 464, 468},
+	{516, 465, 467},
+	{515, 466, 466},
+	{514, 467, 465},
+	{513, 468, 464},
+	{519, 490, 491},
+	{518, 491, 490},
+	{521, 483, 484},
+	{520, 484, 483},
+	{523, 476, 477},
+	{522, 477, 476},
+	{525, 469, 470},
+	{524, 470, 469},
+	{528, 550, 552},
+	{527, 551, 551},
+	{526, 552, 550},
+	{531, 547, 549},
+	{530, 548, 548},
+	{529, 549, 547},
+	{534, 544, 546},
+	{533, 545, 545},
+	{532, 546, 544},
+	{537, 541, 543},
+	{536, 542, 542},
+	{535, 543, 541},
+	{540, 538, 540},
+	{539, 539, 539},
+	{538, 540, 538},
+	{543, 535, 537},
+	{542, 536, 536},
+	{541, 537, 535},
+	{546, 532, 534},
+	{545, 533, 533},
+	{544, 534, 532},
+	{549, 529, 531},
+	{548, 530, 530},
+	{547, 531, 529},
+	{552, 526, 528},
+	{551, 527, 527},
+	{550, 528, 526},
+	{560, 795, 794},
+	{559, 796, 793},
+	{558, 797, 792},
+	{557, 798, 791},
+	{556, 791, 798},
+	{555, 792, 797},
+	{554, 793, 796},
+	{553, 794, 795},
+	{580, 808, 813},
+	{579, 809, 812},
+	{578, 810, 811},
+	{577, 805, 816},
+	{576, 806, 815},
+	{575, 807, 814},
+	{574, 781, 780},
+	{573, 782, 779},
+	{572, 783, 778},
+	{571, 784, 777},
+	{570, 777, 784},
+	{569, 778, 783},
+	{568, 779, 782},
+	{567, 780, 781},
+	{566, 814, 807},
+	{565, 815, 806},
+	{564, 816, 805},
+	{563, 811, 810},
+	{562, 812, 809},
+	{561, 813, 808},
+	{588, 767, 766},
+	{587, 768, 765},
+	{586, 769, 764},
+	{585, 770, 763},
+	{584, 763, 770},
+	{583, 764, 769},
+	{582, 765, 768},
+	{581, 766, 767},
+	{608, 788, 801},
+	{607, 789, 800},
+	{606, 790, 799},
+	{605, 785, 804},
+	{604, 786, 803},
+	{603, 787, 802},
+	{602, 753, 752},
+	{601, 754, 751},
+	{600, 755, 750},
+	{599, 756, 749},
+	{598, 749, 756},
+	{597, 750, 755},
+	{596, 751, 754},
+	{595, 752, 753},
+	{594, 802, 787},
+	{593, 803, 786},
+	{592, 804, 785},
+	{591, 799, 790},
+	{590, 800, 789},
+	{589, 801, 788},
+	{616, 739, 738},
+	{615, 740, 737},
+	{614, 741, 736},
+	{613, 742, 735},
+	{612, 735, 742},
+	{611, 736, 741},
+	{610, 737, 740},
+	{609, 738, 739},
+	{636, 760, 773},
+	{635, 761, 772},
+	{634, 762, 771},
+	{633, 757, 776},
+	{632, 758, 775},
+	{631, 759, 774},
+	{630, 725, 724},
+	{629, 726, 723},
+	{628, 727, 722},
+	{627, 728, 721},
+	{626, 721, 728},
+	{625, 722, 727},
+	{624, 723, 726},
+	{623, 724, 725},
+	{622, 774, 759},
+	{621, 775, 758},
+	{620, 776, 757},
+	{619, 771, 762},
+	{618, 772, 761},
+	{617, 773, 760},
+	{644, 711, 710},
+	{643, 712, 709},
+	{642, 713, 708},
+	{641, 714, 707},
+	{640, 707, 714},
+	{639, 708, 713},
+	{638, 709, 712},
+	{637, 710, 711},
+	{664, 732, 745},
+	{663, 733, 744},
+	{662, 734, 743},
+	{661, 729, 748},
+	{660, 730, 747},
+	{659, 731, 746},
+	{658, 697, 696},
+	{657, 698, 695},
+	{656, 699, 694},
+	{655, 700, 693},
+	{654, 693, 700},
+	{653, 694, 699},
+	{652, 695, 698},
+	{651, 696, 697},
+	{650, 746, 731},
+	{649, 747, 730},
+	{648, 748, 729},
+	{647, 743, 734},
+	{646, 744, 733},
+	{645, 745, 732},
+	{672, 683, 682},
+	{671, 684, 681},
+	{670, 685, 680},
+	{669, 686, 679},
+	{668, 679, 686},
+	{667, 680, 685},
+	{666, 681, 684},
+	{665, 682, 683},
+	{692, 704, 717},
+	{691, 705, 716},
+	{690, 706, 715},
+	{689, 701, 720},
+	{688, 702, 719},
+	{687, 703, 718},
+	{686, 669, 668},
+	{685, 670, 667},
+	{684, 671, 666},
+	{683, 672, 665},
+	{682, 665, 672},
+	{681, 666, 671},
+	{680, 667, 670},
+	{679, 668, 669},
+	{678, 718, 703},
+	{677, 719, 702},
+	{676, 720, 701},
+	{675, 715, 706},
+	{674, 716, 705},
+	{673, 717, 704},
+	{700, 655, 654},
+	{699, 656, 653},
+	{698, 657, 652},
+	{697, 658, 651},
+	{696, 651, 658},
+	{695, 652, 657},
+	{694, 653, 656},
+	{693, 654, 655},
+	{720, 676, 689},
+	{719, 677, 688},
+	{718, 678, 687},
+	{717, 673, 692},
+	{716, 674, 691},
+	{715, 675, 690},
+	{714, 641, 640},
+	{713, 642, 639},
+	{712, 643, 638},
+	{711, 644, 637},
+	{710, 637, 644},
+	{709, 638, 643},
+	{708, 639, 642},
+	{707, 640, 641},
+	{706, 690, 675},
+	{705, 691, 674},
+	{704, 692, 673},
+	{703, 687, 678},
+	{702, 688, 677},
+	{701, 689, 676},
+	{728, 627, 626},
+	{727, 628, 625},
+	{726, 629, 624},
+	{725, 630, 623},
+	{724, 623, 630},
+	{723, 624, 629},
+	{722, 625, 628},
+	{721, 626, 627},
+	{748, 648, 661},
+	{747, 649, 660},
+	{746, 650, 659},
+	{745, 645, 664},
+	{744, 646, 663},
+	{743, 647, 662},
+	{742, 613, 612},
+	{741, 614, 611},
+	{740, 615, 610},
+	{739, 616, 609},
+	{738, 609, 616},
+	{737, 610, 615},
+	{736, 611, 614},
+	{735, 612, 613},
+	{734, 662, 647},
+	{733, 663, 646},
+	{732, 664, 645},
+	{731, 659, 650},
+	{730, 660, 649},
+	{729, 661, 648},
+	{756, 599, 598},
+	{755, 600, 597},
+	{754, 601, 596},
+	{753, 602, 595},
+	{752, 595, 602},
+	{751, 596, 601},
+	{750, 597, 600},
+	{749, 598, 599},
+	{776, 620, 633},
+	{775, 621, 632},
+	{774, 622, 631},
+	{773, 617, 636},
+	{772, 618, 635},
+	{771, 619, 634},
+	{770, 585, 584},
+	{769, 586, 583},
+	{768, 587, 582},
+	{767, 588, 581},
+	{766, 581, 588},
+	{765, 582, 587},
+	{764, 583, 586},
+	{763, 584, 585},
+	{762, 634, 619},
+	{761, 635, 618},
+	{760, 636, 617},
+	{759, 631, 622},
+	{758, 632, 621},
+	{757, 633, 620},
+	{784, 571, 570},
+	{783, 572, 569},
+	{782, 573, 568},
+	{781, 574, 567},
+	{780, 567, 574},
+	{779, 568, 573},
+	{778, 569, 572},
+	{777, 570, 571},
+	{804, 592, 605},
+	{803, 593, 604},
+	{802, 594, 603},
+	{801, 589, 608},
+	{800, 590, 607},
+	{799, 591, 606},
+	{798, 557, 556},
+	{797, 558, 555},
+	{796, 559, 554},
+	{795, 560, 553},
+	{794, 553, 560},
+	{793, 554, 559},
+	{792, 555, 558},
+	{791, 556, 557},
+	{790, 606, 591},
+	{789, 607, 590},
+	{788, 608, 589},
+	{787, 603, 594},
+	{786, 604, 593},
+	{785, 605, 592},
+	{816, 564, 577},
+	{815, 565, 576},
+	{814, 566, 575},
+	{813, 561, 580},
+	{812, 562, 579},
+	{811, 563, 578},
+	{810, 578, 563},
+	{809, 579, 562},
+	{808, 580, 561},
+	{807, 575, 566},
+	{806, 576, 565},
+	{805, 577, 564},
+	{824, 1001, 1000},
+	{823, 1002, 999},
+	{822, 1003, 998},
+	{821, 1004, 997},
+	{820, 997, 1004},
+	{819, 998, 1003},
+	{818, 999, 1002},
+	{817, 1000, 1001},
+	{840, 1019, 1022},
+	{839, 1020, 1021},
+	{838, 1017, 1024},
+	{837, 1018, 1023},
+	{836, 989, 988},
+	{835, 990, 987},
+	{834, 991, 986},
+	{833, 992, 985},
+	{832, 985, 992},
+	{831, 986, 991},
+	{830, 987, 990},
+	{829, 988, 989},
+	{828, 1023, 1018},
+	{827, 1024, 1017},
+	{826, 1021, 1020},
+	{825, 1022, 1019},
+	{848, 977, 976},
+	{847, 978, 975},
+	{846, 979, 974},
+	{845, 980, 973},
+	{844, 973, 980},
+	{843, 974, 979},
+	{842, 975, 978},
+	{841, 976, 977},
+	{864, 1011, 1014},
+	{863, 1012, 1013},
+	{862, 1009, 1016},
+	{861, 1010, 1015},
+	{860, 965, 964},
+	{859, 966, 963},
+	{858, 967, 962},
+	{857, 968, 961},
+	{856, 961, 968},
+	{855, 962, 967},
+	{854, 963, 966},
+	{853, 964, 965},
+	{852, 1015, 1010},
+	{851, 1016, 1009},
+	{850, 1013, 1012},
+	{849, 1014, 1011},
+	{872, 953, 952},
+	{871, 954, 951},
+	{870, 955, 950},
+	{869, 956, 949},
+	{868, 949, 956},
+	{867, 950, 955},
+	{866, 951, 954},
+	{865, 952, 953},
+	{888, 995, 1006},
+	{887, 996, 1005},
+	{886, 993, 1008},
+	{885, 994, 1007},
+	{884, 941, 940},
+	{883, 942, 939},
+	{882, 943, 938},
+	{881, 944, 937},
+	{880, 937, 944},
+	{879, 938, 943},
+	{878, 939, 942},
+	{877, 940, 941},
+	{876, 1007, 994},
+	{875, 1008, 993},
+	{874, 1005, 996},
+	{873, 1006, 995},
+	{896, 929, 928},
+	{895, 930, 927},
+	{894, 931, 926},
+	{893, 932, 925},
+	{892, 925, 932},
+	{891, 926, 931},
+	{890, 927, 930},
+	{889, 928, 929},
+	{912, 971, 982},
+	{911, 972, 981},
+	{910, 969, 984},
+	{909, 970, 983},
+	{908, 917, 916},
+	{907, 918, 915},
+	{906, 919, 914},
+	{905, 920, 913},
+	{904, 913, 920},
+	{903, 914, 919},
+	{902, 915, 918},
+	{901, 916, 917},
+	{900, 983, 970},
+	{899, 984, 969},
+	{898, 981, 972},
+	{897, 982, 971},
+	{920, 905, 904},
+	{919, 906, 903},
+	{918, 907, 902},
+	{917, 908, 901},
+	{916, 901, 908},
+	{915, 902, 907},
+	{914, 903, 906},
+	{913, 904, 905},
+	{936, 947, 958},
+	{935, 948, 957},
+	{934, 945, 960},
+	{933, 946, 959},
+	{932, 893, 892},
+	{931, 894, 891},
+	{930, 895, 890},
+	{929, 896, 889},
+	{928, 889, 896},
+	{927, 890, 895},
+	{926, 891, 894},
+	{925, 892, 893},
+	{924, 959, 946},
+	{923, 960, 945},
+	{922, 957, 948},
+	{921, 958, 947},
+	{944, 881, 880},
+	{943, 882, 879},
+	{942, 883, 878},
+	{941, 884, 877},
+	{940, 877, 884},
+	{939, 878, 883},
+	{938, 879, 882},
+	{937, 880, 881},
+	{960, 923, 934},
+	{959, 924, 933},
+	{958, 921, 936},
+	{957, 922, 935},
+	{956, 869, 868},
+	{955, 870, 867},
+	{954, 871, 866},
+	{953, 872, 865},
+	{952, 865, 872},
+	{951, 866, 871},
+	{950, 867, 870},
+	{949, 868, 869},
+	{948, 935, 922},
+	{947, 936, 921},
+	{946, 933, 924},
+	{945, 934, 923},
+	{968, 857, 856},
+	{967, 858, 855},
+	{966, 859, 854},
+	{965, 860, 853},
+	{964, 853, 860},
+	{963, 854, 859},
+	{962, 855, 858},
+	{961, 856, 857},
+	{984, 899, 910},
+	{983, 900, 909},
+	{982, 897, 912},
+	{981, 898, 911},
+	{980, 845, 844},
+	{979, 846, 843},
+	{978, 847, 842},
+	{977, 848, 841},
+	{976, 841, 848},
+	{975, 842, 847},
+	{974, 843, 846},
+	{973, 844, 845},
+	{972, 911, 898},
+	{971, 912, 897},
+	{970, 909, 900},
+	{969, 910, 899},
+	{992, 833, 832},
+	{991, 834, 831},
+	{990, 835, 830},
+	{989, 836, 829},
+	{988, 829, 836},
+	{987, 830, 835},
+	{986, 831, 834},
+	{985, 832, 833},
+	{1008, 875, 886},
+	{1007, 876, 885},
+	{1006, 873, 888},
+	{1005, 874, 887},
+	{1004, 821, 820},
+	{1003, 822, 819},
+	{1002, 823, 818},
+	{1001, 824, 817},
+	{1000, 817, 824},
+	{999, 818, 823},
+	{998, 819, 822},
+	{997, 820, 821},
+	{996, 887, 874},
+	{995, 888, 873},
+	{994, 885, 876},
+	{993, 886, 875},
+	{1016, 851, 862},
+	{1015, 852, 861},
+	{1014, 849, 864},
+	{1013, 850, 863},
+	{1012, 863, 850},
+	{1011, 864, 849},
+	{1010, 861, 852},
+	{1009, 862, 851},
+	{1024, 827, 838},
+	{1023, 828, 837},
+	{1022, 825, 840},
+	{1021, 826, 839},
+	{1020, 839, 826},
+	{1019, 840, 825},
+	{1018, 837, 828},
+	{1017, 838, 827},
+	{1035, 1137, 1147},
+	{1034, 1138, 1146},
+	{1033, 1139, 1145},
+	{1032, 1140, 1144},
+	{1031, 1154, 1156},
+	{1030, 1155, 1155},
+	{1029, 1156, 1154},
+	{1028, 1144, 1140},
+	{1027, 1145, 1139},
+	{1026, 1146, 1138},
+	{1025, 1147, 1137},
+	{1038, 1151, 1153},
+	{1037, 1152, 1152},
+	{1036, 1153, 1151},
+	{1049, 1123, 1133},
+	{1048, 1124, 1132},
+	{1047, 1125, 1131},
+	{1046, 1126, 1130},
+	{1045, 1148, 1150},
+	{1044, 1149, 1149},
+	{1043, 1150, 1148},
+	{1042, 1130, 1126},
+	{1041, 1131, 1125},
+	{1040, 1132, 1124},
+	{1039, 1133, 1123},
+	{1052, 1141, 1143},
+	{1051, 1142, 1142},
+	{1050, 1143, 1141},
+	{1063, 1109, 1119},
+	{1062, 1110, 1118},
+	{1061, 1111, 1117},
+	{1060, 1112, 1116},
+	{1059, 1134, 1136},
+	{1058, 1135, 1135},
+	{1057, 1136, 1134},
+	{1056, 1116, 1112},
+	{1055, 1117, 1111},
+	{1054, 1118, 1110},
+	{1053, 1119, 1109},
+	{1066, 1127, 1129},
+	{1065, 1128, 1128},
+	{1064, 1129, 1127},
+	{1077, 1095, 1105},
+	{1076, 1096, 1104},
+	{1075, 1097, 1103},
+	{1074, 1098, 1102},
+	{1073, 1120, 1122},
+	{1072, 1121, 1121},
+	{1071, 1122, 1120},
+	{1070, 1102, 1098},
+	{1069, 1103, 1097},
+	{1068, 1104, 1096},
+	{1067, 1105, 1095},
+	{1080, 1113, 1115},
+	{1079, 1114, 1114},
+	{1078, 1115, 1113},
+	{1091, 1081, 1091},
+	{1090, 1082, 1090},
+	{1089, 1083, 1089},
+	{1088, 1084, 1088},
+	{1087, 1106, 1108},
+	{1086, 1107, 1107},
+	{1085, 1108, 1106},
+	{1084, 1088, 1084},
+	{1083, 1089, 1083},
+	{1082, 1090, 1082},
+	{1081, 1091, 1081},
+	{1094, 1099, 1101},
+	{1093, 1100, 1100},
+	{1092, 1101, 1099},
+	{1105, 1067, 1077},
+	{1104, 1068, 1076},
+	{1103, 1069, 1075},
+	{1102, 1070, 1074},
+	{1101, 1092, 1094},
+	{1100, 1093, 1093},
+	{1099, 1094, 1092},
+	{1098, 1074, 1070},
+	{1097, 1075, 1069},
+	{1096, 1076, 1068},
+	{1095, 1077, 1067},
+	{1108, 1085, 1087},
+	{1107, 1086, 1086},
+	{1106, 1087, 1085},
+	{1119, 1053, 1063},
+	{1118, 1054, 1062},
+	{1117, 1055, 1061},
+	{1116, 1056, 1060},
+	{1115, 1078, 1080},
+	{1114, 1079, 1079},
+	{1113, 1080, 1078},
+	{1112, 1060, 1056},
+	{1111, 1061, 1055},
+	{1110, 1062, 1054},
+	{1109, 1063, 1053},
+	{1122, 1071, 1073},
+	{1121, 1072, 1072},
+	{1120, 1073, 1071},
+	{1133, 1039, 1049},
+	{1132, 1040, 1048},
+	{1131, 1041, 1047},
+	{1130, 1042, 1046},
+	{1129, 1064, 1066},
+	{1128, 1065, 1065},
+	{1127, 1066, 1064},
+	{1126, 1046, 1042},
+	{1125, 1047, 1041},
+	{1124, 1048, 1040},
+	{1123, 1049, 1039},
+	{1136, 1057, 1059},
+	{1135, 1058, 1058},
+	{1134, 1059, 1057},
+	{1147, 1025, 1035},
+	{1146, 1026, 1034},
+	{1145, 1027, 1033},
+	{1144, 1028, 1032},
+	{1143, 1050, 1052},
+	{1142, 1051, 1051},
+	{1141, 1052, 1050},
+	{1140, 1032, 1028},
+	{1139, 1033, 1027},
+	{1138, 1034, 1026},
+	{1137, 1035, 1025},
+	{1150, 1043, 1045},
+	{1149, 1044, 1044},
+	{1148, 1045, 1043},
+	{1153, 1036, 1038},
+	{1152, 1037, 1037},
+	{1151, 1038, 1036},
+	{1156, 1029, 1031},
+	{1155, 1030, 1030},
+	{1154, 1031, 1029},
+	{1168, 1256, 1261},
+	{1167, 1257, 1260},
+	{1166, 1258, 1259},
+	{1165, 1253, 1264},
+	{1164, 1254, 1263},
+	{1163, 1255, 1262},
+	{1162, 1262, 1255},
+	{1161, 1263, 1254},
+	{1160, 1264, 1253},
+	{1159, 1259, 1258},
+	{1158, 1260, 1257},
+	{1157, 1261, 1256},
+	{1180, 1244, 1249},
+	{1179, 1245, 1248},
+	{1178, 1246, 1247},
+	{1177, 1241, 1252},
+	{1176, 1242, 1251},
+	{1175, 1243, 1250},
+	{1174, 1250, 1243},
+	{1173, 1251, 1242},
+	{1172, 1252, 1241},
+	{1171, 1247, 1246},
+	{1170, 1248, 1245},
+	{1169, 1249, 1244},
+	{1192, 1232, 1237},
+	{1191, 1233, 1236},
+	{1190, 1234, 1235},
+	{1189, 1229, 1240},
+	{1188, 1230, 1239},
+	{1187, 1231, 1238},
+	{1186, 1238, 1231},
+	{1185, 1239, 1230},
+	{1184, 1240, 1229},
+	{1183, 1235, 1234},
+	{1182, 1236, 1233},
+	{1181, 1237, 1232},
+	{1204, 1220, 1225},
+	{1203, 1221, 1224},
+	{1202, 1222, 1223},
+	{1201, 1217, 1228},
+	{1200, 1218, 1227},
+	{1199, 1219, 1226},
+	{1198, 1226, 1219},
+	{1197, 1227, 1218},
+	{1196, 1228, 1217},
+	{1195, 1223, 1222},
+	{1194, 1224, 1221},
+	{1193, 1225, 1220},
+	{1216, 1208, 1213},
+	{1215, 1209, 1212},
+	{1214, 1210, 1211},
+	{1213, 1205, 1216},
+	{1212, 1206, 1215},
+	{1211, 1207, 1214},
+	{1210, 1214, 1207},
+	{1209, 1215, 1206},
+	{1208, 1216, 1205},
+	{1207, 1211, 1210},
+	{1206, 1212, 1209},
+	{1205, 1213, 1208},
+	{1228, 1196, 1201},
+	{1227, 1197, 1200},
+	{1226, 1198, 1199},
+	{1225, 1193, 1204},
+	{1224, 1194, 1203},
+	{1223, 1195, 1202},
+	{1222, 1202, 1195},
+	{1221, 1203, 1194},
+	{1220, 1204, 1193},
+	{1219, 1199, 1198},
+	{1218, 1200, 1197},
+	{1217, 1201, 1196},
+	{1240, 1184, 1189},
+	{1239, 1185, 1188},
+	{1238, 1186, 1187},
+	{1237, 1181, 1192},
+	{1236, 1182, 1191},
+	{1235, 1183, 1190},
+	{1234, 1190, 1183},
+	{1233, 1191, 1182},
+	{1232, 1192, 1181},
+	{1231, 1187, 1186},
+	{1230, 1188, 1185},
+	{1229, 1189, 1184},
+	{1252, 1172, 1177},
+	{1251, 1173, 1176},
+	{1250, 1174, 1175},
+	{1249, 1169, 1180},
+	{1248, 1170, 1179},
+	{1247, 1171, 1178},
+	{1246, 1178, 1171},
+	{1245, 1179, 1170},
+	{1244, 1180, 1169},
+	{1243, 1175, 1174},
+	{1242, 1176, 1173},
+	{1241, 1177, 1172},
+	{1264, 1160, 1165},
+	{1263, 1161, 1164},
+	{1262, 1162, 1163},
+	{1261, 1157, 1168},
+	{1260, 1158, 1167},
+	{1259, 1159, 1166},
+	{1258, 1166, 1159},
+	{1257, 1167, 1158},
+	{1256, 1168, 1157},
+	{1255, 1163, 1162},
+	{1254, 1164, 1161},
+	{1253, 1165, 1160},
+	{1276, 1364, 1369},
+	{1275, 1365, 1368},
+	{1274, 1366, 1367},
+	{1273, 1361, 1372},
+	{1272, 1362, 1371},
+	{1271, 1363, 1370},
+	{1270, 1370, 1363},
+	{1269, 1371, 1362},
+	{1268, 1372, 1361},
+	{1267, 1367, 1366},
+	{1266, 1368, 1365},
+	{1265, 1369, 1364},
+	{1288, 1352, 1357},
+	{1287, 1353, 1356},
+	{1286, 1354, 1355},
+	{1285, 1349, 1360},
+	{1284, 1350, 1359},
+	{1283, 1351, 1358},
+	{1282, 1358, 1351},
+	{1281, 1359, 1350},
+	{1280, 1360, 1349},
+	{1279, 1355, 1354},
+	{1278, 1356, 1353},
+	{1277, 1357, 1352},
+	{1300, 1340, 1345},
+	{1299, 1341, 1344},
+	{1298, 1342, 1343},
+	{1297, 1337, 1348},
+	{1296, 1338, 1347},
+	{1295, 1339, 1346},
+	{1294, 1346, 1339},
+	{1293, 1347, 1338},
+	{1292, 1348, 1337},
+	{1291, 1343, 1342},
+	{1290, 1344, 1341},
+	{1289, 1345, 1340},
+	{1312, 1328, 1333},
+	{1311, 1329, 1332},
+	{1310, 1330, 1331},
+	{1309, 1325, 1336},
+	{1308, 1326, 1335},
+	{1307, 1327, 1334},
+	{1306, 1334, 1327},
+	{1305, 1335, 1326},
+	{1304, 1336, 1325},
+	{1303, 1331, 1330},
+	{1302, 1332, 1329},
+	{1301, 1333, 1328},
+	{1324, 1316, 1321},
+	{1323, 1317, 1320},
+	{1322, 1318, 1319},
+	{1321, 1313, 1324},
+	{1320, 1314, 1323},
+	{1319, 1315, 1322},
+	{1318, 1322, 1315},
+	{1317, 1323, 1314},
+	{1316, 1324, 1313},
+	{1315, 1319, 1318},
+	{1314, 1320, 1317},
+	{1313, 1321, 1316},
+	{1336, 1304, 1309},
+	{1335, 1305, 1308},
+	{1334, 1306, 1307},
+	{1333, 1301, 1312},
+	{1332, 1302, 1311},
+	{1331, 1303, 1310},
+	{1330, 1310, 1303},
+	{1329, 1311, 1302},
+	{1328, 1312, 1301},
+	{1327, 1307, 1306},
+	{1326, 1308, 1305},
+	{1325, 1309, 1304},
+	{1348, 1292, 1297},
+	{1347, 1293, 1296},
+	{1346, 1294, 1295},
+	{1345, 1289, 1300},
+	{1344, 1290, 1299},
+	{1343, 1291, 1298},
+	{1342, 1298, 1291},
+	{1341, 1299, 1290},
+	{1340, 1300, 1289},
+	{1339, 1295, 1294},
+	{1338, 1296, 1293},
+	{1337, 1297, 1292},
+	{1360, 1280, 1285},
+	{1359, 1281, 1284},
+	{1358, 1282, 1283},
+	{1357, 1277, 1288},
+	{1356, 1278, 1287},
+	{1355, 1279, 1286},
+	{1354, 1286, 1279},
+	{1353, 1287, 1278},
+	{1352, 1288, 1277},
+	{1351, 1283, 1282},
+	{1350, 1284, 1281},
+	{1349, 1285, 1280},
+	{1372, 1268, 1273},
+	{1371, 1269, 1272},
+	{1370, 1270, 1271},
+	{1369, 1265, 1276},
+	{1368, 1266, 1275},
+	{1367, 1267, 1274},
+	{1366, 1274, 1267},
+	{1365, 1275, 1266},
+	{1364, 1276, 1265},
+	{1363, 1271, 1270},
+	{1362, 1272, 1269},
+	{1361, 1273, 1268},
+	{1380, 1557, 1556},
+	{1379, 1558, 1555},
+	{1378, 1559, 1554},
+	{1377, 1560, 1553},
+	{1376, 1553, 1560},
+	{1375, 1554, 1559},
+	{1374, 1555, 1558},
+	{1373, 1556, 1557},
+	{1396, 1575, 1578},
+	{1395, 1576, 1577},
+	{1394, 1573, 1580},
+	{1393, 1574, 1579},
+	{1392, 1545, 1544},
+	{1391, 1546, 1543},
+	{1390, 1547, 1542},
+	{1389, 1548, 1541},
+	{1388, 1541, 1548},
+	{1387, 1542, 1547},
+	{1386, 1543, 1546},
+	{1385, 1544, 1545},
+	{1384, 1579, 1574},
+	{1383, 1580, 1573},
+	{1382, 1577, 1576},
+	{1381, 1578, 1575},
+	{1404, 1533, 1532},
+	{1403, 1534, 1531},
+	{1402, 1535, 1530},
+	{1401, 1536, 1529},
+	{1400, 1529, 1536},
+	{1399, 1530, 1535},
+	{1398, 1531, 1534},
+	{1397, 1532, 1533},
+	{1420, 1567, 1570},
+	{1419, 1568, 1569},
+	{1418, 1565, 1572},
+	{1417, 1566, 1571},
+	{1416, 1521, 1520},
+	{1415, 1522, 1519},
+	{1414, 1523, 1518},
+	{1413, 1524, 1517},
+	{1412, 1517, 1524},
+	{1411, 1518, 1523},
+	{1410, 1519, 1522},
+	{1409, 1520, 1521},
+	{1408, 1571, 1566},
+	{1407, 1572, 1565},
+	{1406, 1569, 1568},
+	{1405, 1570, 1567},
+	{1428, 1509, 1508},
+	{1427, 1510, 1507},
+	{1426, 1511, 1506},
+	{1425, 1512, 1505},
+	{1424, 1505, 1512},
+	{1423, 1506, 1511},
+	{1422, 1507, 1510},
+	{1421, 1508, 1509},
+	{1444, 1551, 1562},
+	{1443, 1552, 1561},
+	{1442, 1549, 1564},
+	{1441, 1550, 1563},
+	{1440, 1497, 1496},
+	{1439, 1498, 1495},
+	{1438, 1499, 1494},
+	{1437, 1500, 1493},
+	{1436, 1493, 1500},
+	{1435, 1494, 1499},
+	{1434, 1495, 1498},
+	{1433, 1496, 1497},
+	{1432, 1563, 1550},
+	{1431, 1564, 1549},
+	{1430, 1561, 1552},
+	{1429, 1562, 1551},
+	{1452, 1485, 1484},
+	{1451, 1486, 1483},
+	{1450, 1487, 1482},
+	{1449, 1488, 1481},
+	{1448, 1481, 1488},
+	{1447, 1482, 1487},
+	{1446, 1483, 1486},
+	{1445, 1484, 1485},
+	{1468, 1527, 1538},
+	{1467, 1528, 1537},
+	{1466, 1525, 1540},
+	{1465, 1526, 1539},
+	{1464, 1473, 1472},
+	{1463, 1474, 1471},
+	{1462, 1475, 1470},
+	{1461, 1476, 1469},
+	{1460, 1469, 1476},
+	{1459, 1470, 1475},
+	{1458, 1471, 1474},
+	{1457, 1472, 1473},
+	{1456, 1539, 1526},
+	{1455, 1540, 1525},
+	{1454, 1537, 1528},
+	{1453, 1538, 1527},
+	{1476, 1461, 1460},
+	{1475, 1462, 1459},
+	{1474, 1463, 1458},
+	{1473, 1464, 1457},
+	{1472, 1457, 1464},
+	{1471, 1458, 1463},
+	{1470, 1459, 1462},
+	{1469, 1460, 1461},
+	{1492, 1503, 1514},
+	{1491, 1504, 1513},
+	{1490, 1501, 1516},
+	{1489, 1502, 1515},
+	{1488, 1449, 1448},
+	{1487, 1450, 1447},
+	{1486, 1451, 1446},
+	{1485, 1452, 1445},
+	{1484, 1445, 1452},
+	{1483, 1446, 1451},
+	{1482, 1447, 1450},
+	{1481, 1448, 1449},
+	{1480, 1515, 1502},
+	{1479, 1516, 1501},
+	{1478, 1513, 1504},
+	{1477, 1514, 1503},
+	{1500, 1437, 1436},
+	{1499, 1438, 1435},
+	{1498, 1439, 1434},
+	{1497, 1440, 1433},
+	{1496, 1433, 1440},
+	{1495, 1434, 1439},
+	{1494, 1435, 1438},
+	{1493, 1436, 1437},
+	{1516, 1479, 1490},
+	{1515, 1480, 1489},
+	{1514, 1477, 1492},
+	{1513, 1478, 1491},
+	{1512, 1425, 1424},
+	{1511, 1426, 1423},
+	{1510, 1427, 1422},
+	{1509, 1428, 1421},
+	{1508, 1421, 1428},
+	{1507, 1422, 1427},
+	{1506, 1423, 1426},
+	{1505, 1424, 1425},
+	{1504, 1491, 1478},
+	{1503, 1492, 1477},
+	{1502, 1489, 1480},
+	{1501, 1490, 1479},
+	{1524, 1413, 1412},
+	{1523, 1414, 1411},
+	{1522, 1415, 1410},
+	{1521, 1416, 1409},
+	{1520, 1409, 1416},
+	{1519, 1410, 1415},
+	{1518, 1411, 1414},
+	{1517, 1412, 1413},
+	{1540, 1455, 1466},
+	{1539, 1456, 1465},
+	{1538, 1453, 1468},
+	{1537, 1454, 1467},
+	{1536, 1401, 1400},
+	{1535, 1402, 1399},
+	{1534, 1403, 1398},
+	{1533, 1404, 1397},
+	{1532, 1397, 1404},
+	{1531, 1398, 1403},
+	{1530, 1399, 1402},
+	{1529, 1400, 1401},
+	{1528, 1467, 1454},
+	{1527, 1468, 1453},
+	{1526, 1465, 1456},
+	{1525, 1466, 1455},
+	{1548, 1389, 1388},
+	{1547, 1390, 1387},
+	{1546, 1391, 1386},
+	{1545, 1392, 1385},
+	{1544, 1385, 1392},
+	{1543, 1386, 1391},
+	{1542, 1387, 1390},
+	{1541, 1388, 1389},
+	{1564, 1431, 1442},
+	{1563, 1432, 1441},
+	{1562, 1429, 1444},
+	{1561, 1430, 1443},
+	{1560, 1377, 1376},
+	{1559, 1378, 1375},
+	{1558, 1379, 1374},
+	{1557, 1380, 1373},
+	{1556, 1373, 1380},
+	{1555, 1374, 1379},
+	{1554, 1375, 1378},
+	{1553, 1376, 1377},
+	{1552, 1443, 1430},
+	{1551, 1444, 1429},
+	{1550, 1441, 1432},
+	{1549, 1442, 1431},
+	{1572, 1407, 1418},
+	{1571, 1408, 1417},
+	{1570, 1405, 1420},
+	{1569, 1406, 1419},
+	{1568, 1419, 1406},
+	{1567, 1420, 1405},
+	{1566, 1417, 1408},
+	{1565, 1418, 1407},
+	{1580, 1383, 1394},
+	{1579, 1384, 1393},
+	{1578, 1381, 1396},
+	{1577, 1382, 1395},
+	{1576, 1395, 1382},
+	{1575, 1396, 1381},
+	{1574, 1393, 1384},
+	{1573, 1394, 1383},
+	{1588, 1765, 1764},
+	{1587, 1766, 1763},
+	{1586, 1767, 1762},
+	{1585, 1768, 1761},
+	{1584, 1761, 1768},
+	{1583, 1762, 1767},
+	{1582, 1763, 1766},
+	{1581, 1764, 1765},
+	{1604, 1783, 1786},
+	{1603, 1784, 1785},
+	{1602, 1781, 1788},
+	{1601, 1782, 1787},
+	{1600, 1753, 1752},
+	{1599, 1754, 1751},
+	{1598, 1755, 1750},
+	{1597, 1756, 1749},
+	{1596, 1749, 1756},
+	{1595, 1750, 1755},
+	{1594, 1751, 1754},
+	{1593, 1752, 1753},
+	{1592, 1787, 1782},
+	{1591, 1788, 1781},
+	{1590, 1785, 1784},
+	{1589, 1786, 1783},
+	{1612, 1741, 1740},
+	{1611, 1742, 1739},
+	{1610, 1743, 1738},
+	{1609, 1744, 1737},
+	{1608, 1737, 1744},
+	{1607, 1738, 1743},
+	{1606, 1739, 1742},
+	{1605, 1740, 1741},
+	{1628, 1775, 1778},
+	{1627, 1776, 1777},
+	{1626, 1773, 1780},
+	{1625, 1774, 1779},
+	{1624, 1729, 1728},
+	{1623, 1730, 1727},
+	{1622, 1731, 1726},
+	{1621, 1732, 1725},
+	{1620, 1725, 1732},
+	{1619, 1726, 1731},
+	{1618, 1727, 1730},
+	{1617, 1728, 1729},
+	{1616, 1779, 1774},
+	{1615, 1780, 1773},
+	{1614, 1777, 1776},
+	{1613, 1778, 1775},
+	{1636, 1717, 1716},
+	{1635, 1718, 1715},
+	{1634, 1719, 1714},
+	{1633, 1720, 1713},
+	{1632, 1713, 1720},
+	{1631, 1714, 1719},
+	{1630, 1715, 1718},
+	{1629, 1716, 1717},
+	{1652, 1759, 1770},
+	{1651, 1760, 1769},
+	{1650, 1757, 1772},
+	{1649, 1758, 1771},
+	{1648, 1705, 1704},
+	{1647, 1706, 1703},
+	{1646, 1707, 1702},
+	{1645, 1708, 1701},
+	{1644, 1701, 1708},
+	{1643, 1702, 1707},
+	{1642, 1703, 1706},
+	{1641, 1704, 1705},
+	{1640, 1771, 1758},
+	{1639, 1772, 1757},
+	{1638, 1769, 1760},
+	{1637, 1770, 1759},
+	{1660, 1693, 1692},
+	{1659, 1694, 1691},
+	{1658, 1695, 1690},
+	{1657, 1696, 1689},
+	{1656, 1689, 1696},
+	{1655, 1690, 1695},
+	{1654, 1691, 1694},
+	{1653, 1692, 1693},
+	{1676, 1735, 1746},
+	{1675, 1736, 1745},
+	{1674, 1733, 1748},
+	{1673, 1734, 1747},
+	{1672, 1681, 1680},
+	{1671, 1682, 1679},
+	{1670, 1683, 1678},
+	{1669, 1684, 1677},
+	{1668, 1677, 1684},
+	{1667, 1678, 1683},
+	{1666, 1679, 1682},
+	{1665, 1680, 1681},
+	{1664, 1747, 1734},
+	{1663, 1748, 1733},
+	{1662, 1745, 1736},
+	{1661, 1746, 1735},
+	{1684, 1669, 1668},
+	{1683, 1670, 1667},
+	{1682, 1671, 1666},
+	{1681, 1672, 1665},
+	{1680, 1665, 1672},
+	{1679, 1666, 1671},
+	{1678, 1667, 1670},
+	{1677, 1668, 1669},
+	{1700, 1711, 1722},
+	{1699, 1712, 1721},
+	{1698, 1709, 1724},
+	{1697, 1710, 1723},
+	{1696, 1657, 1656},
+	{1695, 1658, 1655},
+	{1694, 1659, 1654},
+	{1693, 1660, 1653},
+	{1692, 1653, 1660},
+	{1691, 1654, 1659},
+	{1690, 1655, 1658},
+	{1689, 1656, 1657},
+	{1688, 1723, 1710},
+	{1687, 1724, 1709},
+	{1686, 1721, 1712},
+	{1685, 1722, 1711},
+	{1708, 1645, 1644},
+	{1707, 1646, 1643},
+	{1706, 1647, 1642},
+	{1705, 1648, 1641},
+	{1704, 1641, 1648},
+	{1703, 1642, 1647},
+	{1702, 1643, 1646},
+	{1701, 1644, 1645},
+	{1724, 1687, 1698},
+	{1723, 1688, 1697},
+	{1722, 1685, 1700},
+	{1721, 1686, 1699},
+	{1720, 1633, 1632},
+	{1719, 1634, 1631},
+	{1718, 1635, 1630},
+	{1717, 1636, 1629},
+	{1716, 1629, 1636},
+	{1715, 1630, 1635},
+	{1714, 1631, 1634},
+	{1713, 1632, 1633},
+	{1712, 1699, 1686},
+	{1711, 1700, 1685},
+	{1710, 1697, 1688},
+	{1709, 1698, 1687},
+	{1732, 1621, 1620},
+	{1731, 1622, 1619},
+	{1730, 1623, 1618},
+	{1729, 1624, 1617},
+	{1728, 1617, 1624},
+	{1727, 1618, 1623},
+	{1726, 1619, 1622},
+	{1725, 1620, 1621},
+	{1748, 1663, 1674},
+	{1747, 1664, 1673},
+	{1746, 1661, 1676},
+	{1745, 1662, 1675},
+	{1744, 1609, 1608},
+	{1743, 1610, 1607},
+	{1742, 1611, 1606},
+	{1741, 1612, 1605},
+	{1740, 1605, 1612},
+	{1739, 1606, 1611},
+	{1738, 1607, 1610},
+	{1737, 1608, 1609},
+	{1736, 1675, 1662},
+	{1735, 1676, 1661},
+	{1734, 1673, 1664},
+	{1733, 1674, 1663},
+	{1756, 1597, 1596},
+	{1755, 1598, 1595},
+	{1754, 1599, 1594},
+	{1753, 1600, 1593},
+	{1752, 1593, 1600},
+	{1751, 1594, 1599},
+	{1750, 1595, 1598},
+	{1749, 1596, 1597},
+	{1772, 1639, 1650},
+	{1771, 1640, 1649},
+	{1770, 1637, 1652},
+	{1769, 1638, 1651},
+	{1768, 1585, 1584},
+	{1767, 1586, 1583},
+	{1766, 1587, 1582},
+	{1765, 1588, 1581},
+	{1764, 1581, 1588},
+	{1763, 1582, 1587},
+	{1762, 1583, 1586},
+	{1761, 1584, 1585},
+	{1760, 1651, 1638},
+	{1759, 1652, 1637},
+	{1758, 1649, 1640},
+	{1757, 1650, 1639},
+	{1780, 1615, 1626},
+	{1779, 1616, 1625},
+	{1778, 1613, 1628},
+	{1777, 1614, 1627},
+	{1776, 1627, 1614},
+	{1775, 1628, 1613},
+	{1774, 1625, 1616},
+	{1773, 1626, 1615},
+	{1788, 1591, 1602},
+	{1787, 1592, 1601},
+	{1786, 1589, 1604},
+	{1785, 1590, 1603},
+	{1784, 1603, 1590},
+	{1783, 1604, 1589},
+	{1782, 1601, 1592},
+	{1781, 1602, 1591},
+};
+
+/**
+ * No placement of this piece is mapped onto itself by a symmetry of the board, so each solution and its three images
+ * are four different solutions that contain four different placements of this piece (-1: there is no such piece).
+ */
+#define SYMMETRY_PIECE 0
+
+/**
+ * The piece set: names, version A as rows of '#' and '.' separated by '/', and whether version B (mirrored on the
+ * y-axis) has orientations that are no rotations of version A.
+ */
+static const char* const piece_names[NPIECES] = {"white", "lightgreen", "orange", "darkblue", "grey", "red", "darkgreen", "yellow", "lightblue", "pink", "pinkish", "blue"};
+
+static const char* const piece_shapes[NPIECES] = {"#./##", "##/##", "#./#./##", "#/#/#/#", ".#./###/.#.", "#./##/##", "#./##/.#/.#", "##/#./##", "#../#../###", "#../##./.##", "#./#./##/#.", "#./#./#./##"};
+
+static const short piece_mirrored[NPIECES] = {0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1};
+
+#endif // PLACEMENTS_H
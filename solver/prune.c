@@ -0,0 +1,107 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdint.h>
+#include "solver.h"
+
+static uint64_t fillable[1 << NPIECES];  // for each set of used pieces (bit i: piece i is used): bit n is set if n sites can be filled exactly by some of the unused pieces;
+static short smallest[1 << NPIECES];  // for each set of used pieces: size of the smallest unused piece;
+
+#define PRUNE_MAX_STEPS 4  // maximum number of flood fill steps per region;
+
+
+/**
+ * Computes the tables of region sizes that can be filled by the unused pieces. Must be called before prune_dead_region.
+ */
+void prune_init() {
+
+	short size[NPIECES];
+	for(short i=0; i<NPIECES; ++i) {
+		size[i] = __builtin_popcountll(placements[first_placement[i*BOARD_HEIGHT]].mask);
+	}
+
+	for(int used=(1 << NPIECES)-1; used>=0; --used) {  // supersets come first;
+		fillable[used] = 1;  // the empty region;
+		smallest[used] = 64;
+		for(short i=0; i<NPIECES; ++i) {
+			if(used & (1 << i)) continue;
+			fillable[used] |= fillable[used | (1 << i)] << size[i];
+			if(size[i] < smallest[used]) smallest[used] = size[i];
+		}
+	}
+}
+
+
+/**
+ * @return the sites of region together with their empty neighbours.
+ */
+static uint64_t grow_region(uint64_t const region, uint64_t const empty) {
+	return (region | (region << BOARD_WIDTH) | (region >> BOARD_WIDTH) | ((region << 1) & ~COLUMN_MASK(0)) | ((region >> 1) & ~COLUMN_MASK(BOARD_WIDTH-1))) & empty;
+}
+
+
+/**
+ * Checks whether the piece that was just placed cut off an empty region that can't be filled by the unused pieces.
+ *
+ * Only regions next to the placed piece are flood-filled, and only up to PRUNE_MAX_STEPS steps; regions that are still
+ * growing then are large enough to be fillable in practice and are accepted without further checks.
+ *
+ * @param board -- the bitboard representing the board (including the placed piece).
+ * @param placed -- the sites of the piece that was just placed.
+ * @param pieces -- pointer to the array of all pieces.
+ * @param stats -- counters of the rule that detected the dead region are increased.
+ *
+ * @return 1 if there is a dead region, 0 otherwise.
+ *
+ * @see prune_init
+ *
+ */
+int prune_dead_region(uint64_t const board, uint64_t const placed, struct Piece const* pieces, struct Stats* stats) {
+
+	uint64_t const empty = ~board & FULL_BOARD;
+	uint64_t seeds = grow_region(placed, empty);  // empty sites next to the placed piece;
+	if(seeds == 0) return 0;
+
+	int used = -1;  // set of used pieces, computed when it's needed first;
+
+	while(seeds != 0) {
+		uint64_t region = seeds & -seeds;
+		uint64_t next = grow_region(region, empty);
+		for(short step=0; next != region && step < PRUNE_MAX_STEPS; ++step) {
+			region = next;
+			next = grow_region(region, empty);
+		}
+		seeds &= ~next;
+		if(next != region) continue;  // region is still growing;
+
+		short const size = __builtin_popcountll(region);
+		if(used < 0) used = used_pieces(pieces);
+		if(size < smallest[used]) {
+			stats->npruned_small += 1;
+			return 1;
+		}
+		if((fillable[used] & ((uint64_t)1 << size)) == 0) {
+			stats->npruned_sum += 1;
+			return 1;
+		}
+	}
+
+	return 0;
+}
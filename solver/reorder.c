@@ -0,0 +1,96 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdlib.h>
+#include "reorder.h"
+
+
+/**
+ * @param reorder -- pointer to the reorder buffer.
+ * @param fp -- file the output is written to.
+ * @param window -- maximum number of tasks in flight.
+ */
+void reorder_init(struct Reorder* reorder, FILE* fp, int window) {
+	reorder->fp = fp;
+	reorder->window = window;
+	reorder->slots = calloc(window, sizeof *(reorder->slots));
+	reorder->next = 0;
+	pthread_mutex_init(&reorder->lock, NULL);
+	pthread_cond_init(&reorder->advanced, NULL);
+}
+
+
+void reorder_destroy(struct Reorder* reorder) {
+	free(reorder->slots);
+	pthread_mutex_destroy(&reorder->lock);
+	pthread_cond_destroy(&reorder->advanced);
+}
+
+
+/**
+ * Blocks until the task lies within the window, i.e. until its slot is free.
+ *
+ * @param reorder -- pointer to the reorder buffer.
+ * @param task -- index of the task that is about to start.
+ *
+ */
+void reorder_wait(struct Reorder* reorder, int task) {
+	pthread_mutex_lock(&reorder->lock);
+	while(task >= reorder->next + reorder->window) {
+		pthread_cond_wait(&reorder->advanced, &reorder->lock);
+	}
+	pthread_mutex_unlock(&reorder->lock);
+}
+
+
+/**
+ * Hands in the output of a finished task. If it is the next task to be written, it is written together with all
+ * directly following tasks that are already done.
+ *
+ * @param reorder -- pointer to the reorder buffer.
+ * @param task -- index of the task.
+ * @param buffer -- output of the task, allocated with malloc; the reorder buffer takes ownership.
+ * @param size -- size of the output in bytes.
+ *
+ */
+void reorder_commit(struct Reorder* reorder, int task, char* buffer, size_t size) {
+
+	pthread_mutex_lock(&reorder->lock);
+
+	struct ReorderSlot* slot = &reorder->slots[task % reorder->window];
+	slot->buffer = buffer;
+	slot->size = size;
+
+	short advanced = 0;
+	for(;;) {
+		slot = &reorder->slots[reorder->next % reorder->window];
+		if(slot->buffer == NULL) break;
+		fwrite(slot->buffer, 1, slot->size, reorder->fp);
+		free(slot->buffer);
+		slot->buffer = NULL;
+		reorder->next += 1;
+		advanced = 1;
+	}
+	if(advanced) {
+		pthread_cond_broadcast(&reorder->advanced);
+	}
+
+	pthread_mutex_unlock(&reorder->lock);
+}
@@ -0,0 +1,53 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef REORDER_H
+#define REORDER_H
+
+#include <pthread.h>
+#include <stdio.h>
+
+/**
+ * Reorder buffer: tasks that finish out of order hand in their output, which is written to the file in task order.
+ *
+ * Only a window of tasks following the next task to be written may be in flight at any time; a worker that wants to
+ * start a task beyond the window waits. Memory is therefore bounded by the output of window tasks.
+ */
+
+struct ReorderSlot {
+	char* buffer;  // output of the task (NULL while the task is not done);
+	size_t size;
+};
+
+struct Reorder {
+	FILE* fp;  // output file;
+	int window;  // number of slots; task t uses slot t % window;
+	struct ReorderSlot* slots;
+	int next;  // next task to be written;
+	pthread_mutex_t lock;  // protects slots and next;
+	pthread_cond_t advanced;  // signaled when next was increased;
+};
+
+void reorder_init(struct Reorder* reorder, FILE* fp, int window);
+void reorder_destroy(struct Reorder* reorder);
+void reorder_wait(struct Reorder* reorder, int task);
+void reorder_commit(struct Reorder* reorder, int task, char* buffer, size_t size);
+
+#endif // REORDER_H
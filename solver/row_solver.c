@@ -18,84 +18,417 @@
  *
  ***************************************************************************************/
 
+/**
+ * Finds all solutions of the empty (or a partially filled) board and writes them to constellations.txt, one per line
+ * (or to constellations.bin, see solution_file.h).
+ *
+ * Build:  make (regenerates placements.h if pieces.txt changed), or
+ *         gcc -O2 -o row_solver row_solver.c cells.c prune.c dlx.c parallel.c reorder.c writer.c checkpoint.c frontier.c legal.c stack.c -lpthread
+ * Usage:  row_solver [--solver rows|cells|dlx|frontier] [--branch first|fewest] [--prune] [--symmetric [--expand]] [--count]
+ *                    [--format text|binary] [--async] [--parallel | --threads N] [--split-depth D]
+ *                    [--checkpoint FILE [--checkpoint-interval S]] [--board CODES]
+ *                    [--limit K] [--time-budget MS] [--kernel auto|scalar|sse|avx2] [--engine recursive|stack]
+ *
+ * Prints the number of solutions, the number of nodes of the search tree and the wall time (and the same per thread
+ * if the search runs on multiple threads).
+ *
+ *   --solver rows    row by row search (iter_rows); default.
+ *   --solver cells   branch on an empty site, trying all placements that cover it (iter_cells); different order.
+ *   --solver dlx     Algorithm X with dancing links (see dlx.h); finds the same solutions in a different order.
+ *   --solver frontier
+ *                    count the solutions by dynamic programming over the rows that are not yet complete (see
+ *                    frontier.c) without enumerating them; implies --count and prints the number of states.
+ *   --branch first   cells: branch on the first empty site; default.
+ *   --branch fewest  cells: branch on the empty site with the fewest possible placements (fewer nodes, but slower).
+ *   --prune          rows, cells: after each placement, cut the node if an empty region can't be filled by the unused
+ *                    pieces; prints the number of nodes cut by each rule.
+ *   --symmetric      only find one solution out of each set of four solutions that are mirror images or rotations of
+ *                    each other (the one in which SYMMETRY_PIECE has its canonical placement).
+ *   --expand         with --symmetric: write each solution found together with its three images.
+ *   --count          only count the solutions; constellations.txt is not written.
+ *   --format text    write each solution as a line of the used codes of all pieces (see Piece); default.
+ *   --format binary  write the solutions as fixed-size records to constellations.bin (see solution_file.h).
+ *   --async          format and write the solutions on a separate thread (see writer.h); single-threaded search only,
+ *                    the parallel search writes from memory buffers anyway.
+ *   --parallel       run the row search on one thread per processor core; the output is the same as for a single thread.
+ *   --threads N      run the row search on N threads.
+ *   --split-depth D  number of placed pieces at which the parallel or checkpointed row search is split into tasks (default: 3).
+ *   --checkpoint FILE
+ *                    rows, single thread: search the tasks one after the other and save the remaining ones to FILE
+ *                    every S seconds (see checkpoint.h). If FILE exists the search resumes from it instead of starting
+ *                    over; the output is the same as for an uninterrupted run. FILE is removed when the search is done.
+ *   --checkpoint-interval S
+ *                    seconds between checkpoints (default: 60).
+ *   --board CODES    start from a partially filled board: the used codes of all pieces, comma separated, in the format
+ *                    of constellations.txt, 0 for pieces that are not placed (e.g. 1000,0,0,0,0,0,0,0,0,0,0,2113).
+ *                    Only the remaining pieces and sites are searched.
+ *   --limit K        stop after K solutions (as soon as one more is found).
+ *   --time-budget MS stop after MS milliseconds. Both print whether the search is complete or was stopped early.
+ *   --kernel K       rows: how the placements of a piece in a row are tested against the board (see legal.c): the best
+ *                    one the processor supports (auto, default), or a fixed one.
+ *   --engine stack   rows: search with an explicit stack instead of recursion (iter_rows_stack); same solutions in the
+ *                    same order. --engine recursive (iter_rows) is the default.
+ */
+
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-
-struct Piece {
-	/**
-	 * By default (unrotated state) the piece's larger extent (3 or 4) points in y-direction.
-	 * Parts of the piece are denoted by 1s, gaps (in the enclosing rectangle) by 0s.
-	 */
-	short A[4][3];  // version A;
-	short B[4][3];  // version B; mirrored on the y-axis;
-	short (*version)[4][3];  // current version (either A or B);
-	short symmetric;  // indicates whether mirroring this piece results in a rotated configuration; if yes, version B can be skipped; 1: symmetric, 0: not;
-	short rotations[4];  // indicates whether a rotation is redundant (already covered by a previous rotation); 0: redundant, 1: must be performed;
-	short y_range;  // the actual length of the piece in y-direction;
-	short actual_x_range;  // the actual extent of the piece in x-direction;
-	short x_range_A[4];  // number of non-zero elements in the top row for each rotation; allows for excluding rotations;
-	short x_range_B[4];  // number of non-zero elements in the top row for each rotation;
-	short* x_range;  // current x_range (either x_range_A or x_range_B);
-	int used;  // indicates whether the piece was already used and in which configuration (0: unused, <version>*1000 + <rotation>*100 + <y>*10 + <x>: oterhwise (where <version> is 1 for A and 2 for B));
-	short skip;  // indicates whether the piece should be skipped for the current row;
-};
-
-void create_pieces(struct Piece* pieces);
-void iter_rows(short board[][5], struct Piece* pieces, short const which_row, FILE* fp_constellations);
-int place_piece_on_board(short board[][5], struct Piece* piece, short const which_row, short const x0, short const rotation);
-void remove_piece_from_board(short board[][5], struct Piece* piece, short const which_row, short const x0, short const rotation);
-void print_pieces(struct Piece* pieces);
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "checkpoint.h"
+#include "dlx.h"
+#include "parallel.h"
+#include "reorder.h"
+#include "solution_file.h"
+#include "solver.h"
+
+void run_task(int task, int worker, void* data);
+void search_task(struct Search const* parent, int task, FILE* fp, struct Stats* stats);
+void search_rows(uint64_t* board, struct Piece* pieces, short const which_row, struct Search* search);
+void write_dlx_solution(int const* rows, int nrows, void* search);
+int dlx_interrupted(void* search);
+void print_pieces();
+int place_pieces(char const* codes, uint64_t* board, struct Piece* pieces);
 
 int main (int argc, char** argv) {
 
-	short board[11][5];  // primary index: y-direction (10), secondary: x-direction (5);
-						 // occupied sites are denoted with 1s, free sites with 0s;
-	for(short i=0; i<11; ++i) {
-		for(short j=0; j<5; ++j) {
-			board[i][j] = 0;
+	char const* solver = "rows";  // "rows", "cells", "dlx" or "frontier";
+	short fewest = 0;
+	short prune = 0;
+	short symmetric = 0;
+	short expand = 0;
+	short count = 0;
+	short binary = 0;
+	short async = 0;
+	int nthreads = 1;
+	short split_depth = 3;
+	char const* checkpoint = NULL;  // path of the checkpoint file;
+	int checkpoint_interval = 60;
+	char const* codes = NULL;  // pieces that are already placed;
+	long long limit = 0;
+	long time_budget = 0;  // milliseconds (0: none);
+	char const* kernel = "auto";
+	short iterative = 0;
+	for(int i=1; i<argc; ++i) {
+		if(strcmp(argv[i], "--solver") == 0 && i+1 < argc && (strcmp(argv[i+1], "rows") == 0 || strcmp(argv[i+1], "cells") == 0 || strcmp(argv[i+1], "dlx") == 0 || strcmp(argv[i+1], "frontier") == 0)) {
+			solver = argv[i+1];
+			++i;
+		} else if(strcmp(argv[i], "--branch") == 0 && i+1 < argc && (strcmp(argv[i+1], "first") == 0 || strcmp(argv[i+1], "fewest") == 0)) {
+			fewest = (strcmp(argv[i+1], "fewest") == 0);
+			++i;
+		} else if(strcmp(argv[i], "--prune") == 0) {
+			prune = 1;
+		} else if(strcmp(argv[i], "--symmetric") == 0) {
+			symmetric = 1;
+		} else if(strcmp(argv[i], "--expand") == 0) {
+			expand = 1;
+		} else if(strcmp(argv[i], "--count") == 0) {
+			count = 1;
+		} else if(strcmp(argv[i], "--format") == 0 && i+1 < argc && (strcmp(argv[i+1], "text") == 0 || strcmp(argv[i+1], "binary") == 0)) {
+			binary = (strcmp(argv[i+1], "binary") == 0);
+			++i;
+		} else if(strcmp(argv[i], "--async") == 0) {
+			async = 1;
+		} else if(strcmp(argv[i], "--parallel") == 0) {
+			nthreads = parallel_ncores();
+		} else if(strcmp(argv[i], "--threads") == 0 && i+1 < argc && atoi(argv[i+1]) > 0) {
+			nthreads = atoi(argv[i+1]);
+			++i;
+		} else if(strcmp(argv[i], "--split-depth") == 0 && i+1 < argc && atoi(argv[i+1]) > 0 && atoi(argv[i+1]) < NPIECES) {
+			split_depth = atoi(argv[i+1]);
+			++i;
+		} else if(strcmp(argv[i], "--checkpoint") == 0 && i+1 < argc) {
+			checkpoint = argv[i+1];
+			++i;
+		} else if(strcmp(argv[i], "--checkpoint-interval") == 0 && i+1 < argc && atoi(argv[i+1]) > 0) {
+			checkpoint_interval = atoi(argv[i+1]);
+			++i;
+		} else if(strcmp(argv[i], "--board") == 0 && i+1 < argc) {
+			codes = argv[i+1];
+			++i;
+		} else if(strcmp(argv[i], "--limit") == 0 && i+1 < argc && atoll(argv[i+1]) > 0) {
+			limit = atoll(argv[i+1]);
+			++i;
+		} else if(strcmp(argv[i], "--time-budget") == 0 && i+1 < argc && atol(argv[i+1]) > 0) {
+			time_budget = atol(argv[i+1]);
+			++i;
+		} else if(strcmp(argv[i], "--engine") == 0 && i+1 < argc && (strcmp(argv[i+1], "recursive") == 0 || strcmp(argv[i+1], "stack") == 0)) {
+			iterative = strcmp(argv[i+1], "stack") == 0;
+			++i;
+		} else if(strcmp(argv[i], "--kernel") == 0 && i+1 < argc) {
+			kernel = argv[i+1];
+			++i;
+		} else {
+			fprintf(stderr, "usage: %s [--solver rows|cells|dlx|frontier] [--branch first|fewest] [--prune] [--symmetric [--expand]] [--count] [--format text|binary] [--async] [--parallel | --threads N] [--split-depth D] [--checkpoint FILE [--checkpoint-interval S]] [--board CODES] [--limit K] [--time-budget MS] [--kernel auto|scalar|sse|avx2] [--engine recursive|stack]\n", argv[0]);
+			return 1;
+		}
+	}
+	if(expand && symmetric == 0) {
+		fprintf(stderr, "--expand requires --symmetric\n");
+		return 1;
+	}
+	if(strcmp(solver, "rows") != 0 && nthreads > 1) {
+		fprintf(stderr, "only the rows solver runs on multiple threads\n");
+		return 1;
+	}
+	if(checkpoint != NULL && (strcmp(solver, "rows") != 0 || nthreads > 1 || async)) {
+		fprintf(stderr, "--checkpoint requires the rows solver on a single thread without --async\n");
+		return 1;
+	}
+	if((limit > 0 || time_budget > 0) && (nthreads > 1 || checkpoint != NULL)) {
+		fprintf(stderr, "--limit and --time-budget require a single thread without --checkpoint\n");
+		return 1;
+	}
+	if(strcmp(solver, "frontier") == 0 && (symmetric || prune || limit > 0 || time_budget > 0)) {
+		fprintf(stderr, "--solver frontier counts all solutions; it can't be combined with --symmetric, --prune, --limit or --time-budget\n");
+		return 1;
+	}
+	if(strcmp(solver, "frontier") == 0) {
+		count = 1;
+	}
+	if(symmetric && SYMMETRY_PIECE < 0) {
+		fprintf(stderr, "--symmetric needs a piece none of whose placements is symmetric (see placements.h)\n");
+		return 1;
+	}
+	if(strcmp(solver, "rows") == 0) {  // only iter_rows uses legal_placements;
+		if(largest_placement_group() > 64) {
+			fprintf(stderr, "--solver rows supports at most 64 placements of a piece per row, the piece set has %d; use --solver cells or dlx\n", largest_placement_group());
+			return 1;
 		}
+		if(legal_init(kernel) == NULL) {
+			fprintf(stderr, "kernel %s is not supported\n", kernel);
+			return 1;
+		}
+	}
+	if(codes != NULL && symmetric) {
+		fprintf(stderr, "--symmetric requires the empty board\n");  // the images of a solution don't contain the placed pieces;
+		return 1;
 	}
 
+	uint64_t board = 0;  // bitboard, see ROW_MASK;
+
 	// struct Piece pieces[10];
-	struct Piece* pieces = calloc(12, sizeof *pieces);
+	struct Piece* pieces = calloc(NPIECES, sizeof *pieces);
+
+	// print_pieces();
 
-	create_pieces(pieces);
+	if(codes != NULL && place_pieces(codes, &board, pieces) != 0) {
+		free(pieces);
+		return 1;
+	}
 
-	// print_pieces(pieces);
+	struct Search search = {.split_depth = -1, .fewest = fewest, .prune = prune, .symmetric = symmetric, .expand = expand, .count = count, .binary = binary, .limit = limit, .iterative = iterative, .used = used_pieces(pieces)};
+
+	short resume = 0;
+	long long offset = 0;  // size of the output file at the checkpoint;
+	if(checkpoint != NULL) {
+		search.split_depth = split_depth;  // the tasks are recorded at split_depth, then searched one after the other;
+		search.board_hash = checkpoint_board_hash(pieces);
+		int const status = checkpoint_load(checkpoint, &search, &offset);
+		if(status == -2) {
+			fprintf(stderr, "%s is no valid checkpoint for these options\n", checkpoint);
+			return 1;
+		}
+		resume = (status == 0);
+	}
 
-	FILE* fp_constellations = fopen("constellations.txt", "w");  // will contain all possible solutions;
+	FILE* fp_constellations = NULL;  // will contain all possible solutions;
+	char const* filename = (binary) ? "constellations.bin" : "constellations.txt";
+	struct SolutionFileHeader header = {.version = SOLUTION_FILE_VERSION, .record_size = SOLUTION_RECORD_SIZE, .nplacements = NPLACEMENTS};
+	memcpy(header.magic, SOLUTION_FILE_MAGIC, sizeof header.magic);
+	short const use_writer = (async && nthreads == 1);
+	if(count == 0 && resume) {  // drop what was written after the checkpoint;
+		fp_constellations = fopen(filename, (binary) ? "r+b" : "r+");
+		if(fp_constellations != NULL && use_writer) setvbuf(fp_constellations, NULL, _IOFBF, WRITER_BUFFER_SIZE);  // before any other operation on the file;
+		if(fp_constellations != NULL && (fseek(fp_constellations, 0, SEEK_END) != 0 || ftell(fp_constellations) < offset)) {  // the output at the checkpoint is lost;
+			fprintf(stderr, "%s is shorter than at the checkpoint\n", filename);
+			return 1;
+		}
+		if(fp_constellations == NULL || ftruncate(fileno(fp_constellations), offset) != 0 || fseek(fp_constellations, offset, SEEK_SET) != 0) {
+			fprintf(stderr, "cannot resume writing %s\n", filename);
+			return 1;
+		}
+	} else if(count == 0) {
+		fp_constellations = fopen(filename, (binary) ? "wb" : "w");
+		if(fp_constellations != NULL && use_writer) setvbuf(fp_constellations, NULL, _IOFBF, WRITER_BUFFER_SIZE);  // before the header is written;
+		if(binary) fwrite(&header, sizeof header, 1, fp_constellations);  // the number of solutions is filled in when the search is done;
+	}
+	search.fp = fp_constellations;
 
-	iter_rows(board, pieces, 0, fp_constellations);
+	if(prune) {
+		prune_init();
+	}
+	struct Writer writer;
+	if(use_writer && fp_constellations != NULL) {
+		writer_init(&writer, fp_constellations, binary, 1 << 16);
+		search.writer = &writer;
+	}
 
-	fclose(fp_constellations);
+	long long nstates = 0;  // frontier: number of memoized states;
+
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if(time_budget > 0) {
+		search.budget = 1;
+		search.deadline.tv_sec = start.tv_sec + time_budget/1000 + (start.tv_nsec + (time_budget%1000)*1000000) / 1000000000;
+		search.deadline.tv_nsec = (start.tv_nsec + (time_budget%1000)*1000000) % 1000000000;
+	}
+
+	if(strcmp(solver, "dlx") == 0) {
+		struct Dlx* dlx = dlx_create_lonpos(symmetric);
+		for(short i=0; i<NPIECES; ++i) {
+			if(pieces[i].used != 0) dlx_select_row(dlx, pieces[i].placement);  // place_pieces made sure they don't overlap;
+		}
+		short const callback = (count == 0 || limit > 0 || time_budget > 0);  // without a callback dlx only counts;
+		if(limit > 0 || time_budget > 0) dlx->interrupt = dlx_interrupted;
+		long long const nsolutions = dlx_search(dlx, (callback) ? write_dlx_solution : NULL, &search);
+		if(callback == 0) search.stats.nsolutions = (expand) ? 4*nsolutions : nsolutions;
+		search.stats.nnodes = dlx->nvisited;
+		dlx_free(dlx);
+	} else if(strcmp(solver, "cells") == 0) {
+		iter_cells(&board, pieces, &search);
+	} else if(strcmp(solver, "frontier") == 0) {
+		nstates = frontier_count(board, pieces, &search.stats);
+	} else if(nthreads > 1) {
+		search.split_depth = split_depth;  // first collect the subtrees at split_depth, then search them in parallel;
+		search_rows(&board, pieces, 0, &search);
+		struct Reorder reorder;
+		if(count == 0) {  // nothing to write in order when counting;
+			reorder_init(&reorder, fp_constellations, 16*nthreads);
+			search.reorder = &reorder;
+		}
+		search.worker_stats = calloc(nthreads, sizeof *(search.worker_stats));
+		parallel_for(search.ntasks, nthreads, run_task, &search);
+		for(int w=0; w<nthreads; ++w) {
+			add_stats(&search.stats, &search.worker_stats[w]);
+		}
+		if(count == 0) reorder_destroy(&reorder);
+		free(search.tasks);
+	} else if(checkpoint != NULL) {
+		if(resume == 0) {
+			search_rows(&board, pieces, 0, &search);  // collect the tasks;
+		}
+		struct timespec saved = start, now;
+		for(int t=0; t<search.ntasks; ++t) {
+			search_task(&search, t, fp_constellations, &search.stats);
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			if(now.tv_sec - saved.tv_sec >= checkpoint_interval) {
+				if(fp_constellations != NULL && (fflush(fp_constellations) != 0 || fsync(fileno(fp_constellations)) != 0)) {  // the checkpoint must not refer to output that isn't on disk;
+					fprintf(stderr, "cannot write %s\n", filename);
+				} else if(checkpoint_save(checkpoint, &search, t+1, (fp_constellations != NULL) ? ftell(fp_constellations) : 0) != 0) {
+					fprintf(stderr, "cannot write checkpoint %s\n", checkpoint);
+				}
+				saved = now;
+			}
+		}
+		free(search.tasks);
+		remove(checkpoint);
+	} else {
+		search_rows(&board, pieces, 0, &search);
+	}
+
+	if(search.writer != NULL) {
+		writer_close(&writer);  // wait until all solutions are written;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	if(fp_constellations != NULL && binary) {
+		header.nsolutions = search.stats.nsolutions;
+		rewind(fp_constellations);
+		fwrite(&header, sizeof header, 1, fp_constellations);
+	}
+	if(fp_constellations != NULL) fclose(fp_constellations);
+	free(pieces);
+
+	printf("%lld solutions, %lld nodes, %.3f s\n", search.stats.nsolutions, search.stats.nnodes, (end.tv_sec - start.tv_sec) + 1e-9*(end.tv_nsec - start.tv_nsec));
+	if(search.worker_stats != NULL) {
+		for(int w=0; w<nthreads; ++w) {
+			printf("thread %d: %lld solutions, %lld nodes\n", w, search.worker_stats[w].nsolutions, search.worker_stats[w].nnodes);
+		}
+		free(search.worker_stats);
+	}
+	if(strcmp(solver, "frontier") == 0) {
+		printf("%lld states\n", nstates);
+	}
+	if(limit > 0 || time_budget > 0) {
+		if(search.stop == STOP_LIMIT) printf("stopped early: found %lld solutions\n", limit);
+		else if(search.stop == STOP_TIME) printf("stopped early: time budget of %ld ms used up\n", time_budget);
+		else printf("complete\n");
+	}
+	if(prune) {
+		printf("pruned: %lld (region smaller than any unused piece), %lld (region size no sum of unused pieces)\n", search.stats.npruned_small, search.stats.npruned_sum);
+	}
 
 	return 0;
 }
 
 
-void print_pieces(struct Piece* pieces) {
-	for(short i=0; i<12; ++i) {
-		printf("piece #:%d\n", i+1);
-		printf("\n");
-		for(short y=0; y<pieces[i].y_range; ++y) {
-			for(short x=0; x<pieces[i].actual_x_range; ++x) {
-				if(pieces[i].A[y][x] > 0) printf("+");
-				else printf(" ");
+/**
+ * Puts the pieces of a partially filled board on the board and marks them as used.
+ *
+ * @param codes -- used code of each piece (see Piece), comma separated; 0 for pieces that are not placed.
+ * @param board -- pointer to the (empty) board.
+ * @param pieces -- pointer to the array of all pieces (all unused).
+ *
+ * @return 0 on success, -1 if the list is malformed, a code is no distinct placement of its piece or pieces overlap
+ *         (after printing an error message).
+ *
+ */
+int place_pieces(char const* codes, uint64_t* board, struct Piece* pieces) {
+
+	char const* p = codes;
+	for(short i=0; i<NPIECES; ++i) {
+		char* end;
+		long const used = strtol(p, &end, 10);
+		if(end == p || *end != ((i < NPIECES-1) ? ',' : '\0')) {
+			fprintf(stderr, "--board expects the used codes of all %d pieces, comma separated: %s\n", NPIECES, codes);
+			return -1;
+		}
+		p = end + 1;
+		if(used == 0) continue;
+
+		short found = -1;
+		for(short k=first_placement[i*BOARD_HEIGHT]; k<first_placement[(i+1)*BOARD_HEIGHT]; ++k) {
+			if(placements[k].used != used) continue;
+			if(found >= 0) {  // y == 10 is encoded like rotation+1 (see Placement);
+				fprintf(stderr, "piece %d: %ld is ambiguous\n", i+1, used);
+				return -1;
 			}
-			printf("\n");
+			found = k;
 		}
+		if(found < 0) {
+			fprintf(stderr, "piece %d: %ld is no placement on the board (or a redundant orientation)\n", i+1, used);
+			return -1;
+		}
+		if(place_piece_on_board(board, &placements[found]) != 0) {
+			fprintf(stderr, "piece %d: %ld overlaps another piece\n", i+1, used);
+			return -1;
+		}
+		pieces[i].used = used;
+		pieces[i].placement = found;
+	}
+
+	return 0;
+}
+
+
+void print_pieces() {
+	for(short i=0; i<NPIECES; ++i) {
+		printf("piece #:%d\n", i+1);
 		printf("\n");
-		if(pieces[i].symmetric == 0) {
-			printf("mirrored:\n\n");
-			for(short y=0; y<pieces[i].y_range; ++y) {
-				for(short x=0; x<pieces[i].actual_x_range; ++x) {
-					if(pieces[i].B[y][x] > 0) printf("+");
+		for(short k=first_placement[i*BOARD_HEIGHT]; k<first_placement[i*BOARD_HEIGHT+1]; ++k) {
+			if(placements[k].used % 10 != 0) continue;  // print each orientation only once (at x=0);
+			for(short y=0; y<4; ++y) {
+				for(short x=0; x<4; ++x) {
+					if(placements[k].mask & ((uint64_t)1 << (BOARD_WIDTH*y + x))) printf("+");
 					else printf(" ");
 				}
 				printf("\n");
 			}
+			printf("\n");
 		}
-		printf("\n");
 		printf("--------------------\n");
 		printf("\n");
 	}
@@ -110,591 +443,364 @@ void print_pieces(struct Piece* pieces) {
  *
  */
 void write_combination_to_file(FILE* fp, struct Piece* pieces) {
+#if NPIECES == 12
 	fprintf(fp, "%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d\n", pieces[0].used, pieces[1].used, pieces[2].used, pieces[3].used, pieces[4].used, pieces[5].used, pieces[6].used, pieces[7].used, pieces[8].used, pieces[9].used, pieces[10].used, pieces[11].used);
+#else
+	for(short i=0; i<NPIECES; ++i) {
+		fprintf(fp, (i < NPIECES-1) ? "%d," : "%d\n", pieces[i].used);
+	}
+#endif
 }
 
 
 /**
- * Iterates over the rows of the board, trying to complete one by one.
+ * Writes a valid combination to the file as a record of the binary format.
  *
- * @param board -- pointer to the two-dimensional array representing the board.
- * @param pieces -- pointer to the array of all pieces.
- * @param which_row -- indicates which row the algorithm is currently working on.
- * @param fp_constellations -- pointer to the output file.
+ * @param fp -- pointer to the output file.
+ * @param pieces -- pointer to the array of all pieces (all of them are used).
+ *
+ * @see solution_file.h
  *
  */
-void iter_rows(short board[][5], struct Piece* pieces, short const which_row, FILE* fp_constellations) {
-
-	if(which_row == 11) {  // last row (11th row) was finished by placing a piece (purple) only within that row;
-		write_combination_to_file(fp_constellations, pieces);
-		return;
+void write_record_to_file(FILE* fp, struct Piece* pieces) {
+	short placement_of_piece[NPIECES];
+	for(short i=0; i<NPIECES; ++i) {
+		placement_of_piece[i] = pieces[i].placement;
 	}
+	unsigned char record[SOLUTION_RECORD_SIZE];
+	encode_solution_record(record, placement_of_piece);
+	fwrite(record, sizeof record, 1, fp);
+}
 
-	short nopen=5;  // number of free sites in the current row;
-	for(short j=0; j<5; ++j) {
-		nopen -= board[which_row][j];
-	}
 
-	if(nopen == 0) {  // row is already complete;
-		if(which_row == 10) {  // is the last row;
-			for(short i=0; i<12; ++i) {
-				if(pieces[i].used == 0) pieces[i].skip = 1;  // set each unused piece on skip because skipped pieces are set on unskip after a row was completed in order to make them available for the next row. However there is no additional row after the last one and in case of solutions including only 9 pieces having unused, unskipped pieces can result in an infinite loop (as they will be used in place of the piece that completed the board in subsequent steps which makes it possible to use the completing piece again). Therefore skip them in case the algorithm found a solution.
-			}
-			write_combination_to_file(fp_constellations, pieces);
-		} else {  // is not the last row;
-			iter_rows(board, pieces, which_row+1, fp_constellations);  // move on to the next row;
-		}
+/**
+ * Writes one solution to the file of the search or hands it to the writer thread. A solution beyond the limit is not
+ * written but stops the search, so a board with exactly as many solutions as the limit is reported as complete.
+ */
+static void write_pieces(struct Search* search, struct Piece* pieces) {
+	if(search->limit > 0 && search->stats.nsolutions == search->limit) {
+		search->stop = STOP_LIMIT;
 		return;
 	}
+	if(search->writer != NULL) writer_push(search->writer, pieces);
+	else if(search->binary) write_record_to_file(search->fp, pieces);
+	else write_combination_to_file(search->fp, pieces);
+	search->stats.nsolutions += 1;
+}
 
-	short nused=0;  // how many successive pieces (without gap, from the beginning) have already been used or are currently on skip. At the same time this indicates the position of the piece that will be used this step withing the array of pieces.
-	struct Piece* piece = pieces;
-	while((piece->used > 0 || piece->skip > 0) && nused<12) {
-		piece += 1;
-		nused += 1;
-	}
-	if(nused == 12) return;  // All pieces are either used or on skip for the current row -> no solution could be found.
 
-	short x_max;  // x-value of the 'rightmost' site the piece can be placed on in order not to exceed the boundaries of the board;
-	int success;  // indicates whether the current piece was placed successfully on the board;
+/**
+ * Writes a solution and, if requested, its symmetric images to the file of the search.
+ *
+ * @param search -- pointer to the context of the search.
+ * @param pieces -- pointer to the array of all pieces (all of them are used).
+ *
+ */
+void write_solution(struct Search* search, struct Piece* pieces) {
 
-	for(short rotation=0; rotation<4; ++rotation) {  // loop over rotations; rotation are to be regarded clockwise;
+	if(search->count) {
+		search->stats.nsolutions += (search->expand) ? 4 : 1;
+		if(search->limit > 0 && search->stats.nsolutions > search->limit) {
+			search->stats.nsolutions = search->limit;  // images beyond the limit don't count;
+			search->stop = STOP_LIMIT;
+		}
+		return;
+	}
 
-		if(piece->rotations[rotation] == 0) continue;  // rotation is redundant;
+	write_pieces(search, pieces);
 
-		if(rotation%2 == 0) {  // 0 degrees or 180 degrees;
-			if(which_row + piece->y_range > 11) continue;  // piece would exceed y-range of the board;
-			x_max = 5-piece->actual_x_range;  // x-extent of piece is 2;
-		} else {  // 90 degrees or 270 degrees;
-			if(which_row + piece->actual_x_range > 11) continue;  // piece would exceed y-range of the board;
-			x_max = 5-piece->y_range;  // original y-range becomes x-range;
-		}
+	if(search->expand == 0) return;
 
-		piece->x_range = piece->x_range_A;  // use version A for x_range;
-		if(piece->x_range[rotation] <= nopen) {  // check if there are enough free sites in the current row;
-
-			piece->version = &(piece->A);  // use version A;
-			for(short x=0; x<=x_max; ++x) {  // x denotes the x-position of the left upper corner of the enclosing rectangle within which the piece will be placed;
-
-				success = place_piece_on_board(board, piece, which_row, x, rotation);
-				if(success == 0) {  // no overlap of pieces;
-
-					piece->used = 1000 + 100*rotation + 10*which_row + x;  // mark piece as used (see declaration of Piece for encoding);
-					nopen -= piece->x_range[rotation];  // adjust number of free sites;
-					if(nopen == 0) {  // current row is complete;
-
-						for(short i=0; i<12; ++i) {
-							pieces[i].skip = 0;  // reset skip of pieces in order to make them available for the next row;
-						}
-						iter_rows(board, pieces, which_row+1, fp_constellations);  // move on to the next row;
-					} else {  // row is not complete;
-
-						iter_rows(board, pieces, which_row, fp_constellations);  // stay within the current row;
-					}
-					remove_piece_from_board(board, piece, which_row, x, rotation);  // after deeper recursions returned remove the piece from the board in order to place it at another location or to skip it for the current row;
-					piece->used = 0;  // adjust used indicator;
-					nopen += piece->x_range[rotation];  // adjust number of free sites;
-					for(short i=nused+1; i<12; ++i) {
-						pieces[i].skip = 0;  // reset skip of subsequent pieces so they can be used in the current row (their skip was set in deeper recursions); preceding pieces, if skipped, remain unchanged as their combination with other pieces was already checked in higher recursion levels (only 'forward' (or better 'downward') generation of combinations, no double generation);
-					}
-				}
-			}
+	struct Piece image[NPIECES];
+	for(short s=0; s<3 && search->stop == STOP_NONE; ++s) {
+		for(short i=0; i<NPIECES; ++i) {
+			image[i].placement = symmetric_placements[pieces[i].placement][s];
+			image[i].used = placements[image[i].placement].used;
 		}
+		write_pieces(search, image);
+	}
+}
 
 
-		// repeat the above procedure for version B; for explanations/comments see the part for version A;
-		piece->x_range = piece->x_range_B;
-		if(piece->symmetric == 0 && piece->x_range[rotation] <= nopen) {  // only if the piece is not symmetric, otherwise version B is redundant; see declaration of struct Piece;
+/**
+ * Writes a solution found by the dancing links solver to the file.
+ *
+ * @param rows -- indices of the placements that make up the solution (see placements.h).
+ * @param nrows -- number of placements.
+ * @param search -- pointer to the context of the search.
+ *
+ * @see write_solution
+ *
+ */
+void write_dlx_solution(int const* rows, int nrows, void* search) {
 
-			piece->version = &(piece->B);
-			for(short x=0; x<=x_max; ++x) {
+	struct Piece pieces[NPIECES] = {{0}};
+	for(short i=0; i<nrows; ++i) {
+		pieces[placements[rows[i]].piece].used = placements[rows[i]].used;
+		pieces[placements[rows[i]].piece].placement = rows[i];
+	}
+	write_solution(search, pieces);
+}
 
-				success = place_piece_on_board(board, piece, which_row, x, rotation);
-				if(success == 0) {
 
-					piece->used = 2000 + 100*rotation + 10*which_row + x;
-					nopen -= piece->x_range[rotation];
-					if(nopen == 0) {
+/**
+ * Polled by the dancing links solver.
+ *
+ * @param search -- pointer to the context of the search.
+ *
+ * @return non-zero if the search has to stop.
+ *
+ */
+int dlx_interrupted(void* search) {
+	return search_interrupted(search);
+}
 
-						for(short i=0; i<12; ++i) {
-							pieces[i].skip = 0;
-						}
-						iter_rows(board, pieces, which_row+1, fp_constellations);
-					} else {
 
-						iter_rows(board, pieces, which_row, fp_constellations);
-					}
-					remove_piece_from_board(board, piece, which_row, x, rotation);
-					piece->used = 0;
-					nopen += piece->x_range[rotation];
-					for(short i=nused+1; i<12; ++i) {
-						pieces[i].skip = 0;
-					}
-				}
-			}
+/**
+ * Checks whether the search has to stop early, because enough solutions were found or the deadline has passed.
+ *
+ * @param search -- pointer to the context of the search.
+ *
+ * @return the reason for stopping (STOP_NONE: go on).
+ *
+ */
+int search_interrupted(struct Search* search) {
+	if(search->stop == STOP_NONE && search->budget) {
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if(now.tv_sec > search->deadline.tv_sec || (now.tv_sec == search->deadline.tv_sec && now.tv_nsec >= search->deadline.tv_nsec)) {
+			search->stop = STOP_TIME;
 		}
 	}
-
-	// finally, do not use the current piece for the current row (so it can be used for subsequent rows);
-	piece->skip = 1;
-	iter_rows(board, pieces, which_row, fp_constellations);  // stay within the current row;
+	return search->stop;
 }
 
 
-
 /**
- * Places a piece on the board, if possible.
- * 
- * @param board -- pointer to the two-dimensional array representing the board.
- * @param piece -- pointer to the piece that is to be placed.
- * @param which_row -- indicates which row the algorithm is currently working on.
- * @param x0 -- indicates the x-position of the left upper corner of the enclosing rectangle within which the piece will be placed.
- * @param rotation -- indicates the rotation of the piece.
+ * Searches the subtree of a task; runs on a worker thread of the pool.
+ * The solutions are written to a private buffer which is handed to the reorder buffer once the task is done (unless the
+ * search only counts them).
  *
- * @return 0 if the piece was successfully placed, -1 if the piece could not be placed due to overlap with another piece.
+ * @param task -- index of the task.
+ * @param worker -- index of the worker thread.
+ * @param data -- pointer to the search that recorded the tasks.
+ *
+ * @see parallel_for
  *
  */
-int place_piece_on_board(short board[][5], struct Piece* piece, short const which_row, short const x0, short const rotation) {
-
-	short tmp_board[4][4];  // temporal array for storing the new board values (so in case of an overlap already written board values don't need to be reset);
-	short y_max, x_max;  // the actual y- and x-extent of the piece;
-
-	if(rotation == 0) {  // 0 degrees;
-
-		x_max = piece->actual_x_range;
-		y_max = piece->y_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+void run_task(int task, int worker, void* data) {
 
-				tmp_board[y][x] = board[which_row+y][x0+x] + (*(piece->version))[y][x];
+	struct Search* parent = data;
 
-				if(tmp_board[y][x] > 1) {  // check if pieces overlap;
-					return -1;
-				}
-			}
-		}
-
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+	if(parent->count) {
+		search_task(parent, task, NULL, &parent->worker_stats[worker]);  // only this worker writes to its counters;
+		return;
+	}
 
-				board[which_row+y][x0+x] = tmp_board[y][x];  // if there is no overlap copy the board values from the temp array to the board array;
-			}
-		}
+	reorder_wait(parent->reorder, task);
 
-	} else if(rotation == 1) {  // 90 degrees;
+	char* buffer = NULL;
+	size_t size = 0;
+	FILE* fp = open_memstream(&buffer, &size);
+	search_task(parent, task, fp, &parent->worker_stats[worker]);
+	fclose(fp);
 
-		x_max = piece->y_range;
-		y_max = piece->actual_x_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+	reorder_commit(parent->reorder, task, buffer, size);
+}
 
-				tmp_board[y][x] = board[which_row+y][x0+x] + (*(piece->version))[x_max-1-x][y];
 
-				if(tmp_board[y][x] > 1) {  // check if pieces overlap;
-					return -1;
-				}
-			}
-		}
+/**
+ * Searches the subtree of a task with the options of the search that recorded it.
+ *
+ * @param parent -- pointer to the search that recorded the tasks.
+ * @param task -- index of the task.
+ * @param fp -- output file (NULL if the search only counts).
+ * @param stats -- the counters of the subtree are added to these.
+ *
+ */
+void search_task(struct Search const* parent, int task, FILE* fp, struct Stats* stats) {
 
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+	struct Task const* t = &parent->tasks[task];
 
-				board[which_row+y][x0+x] = tmp_board[y][x];  // if there is no overlap copy the board values from the temp array to the board array;
-			}
-		}
+	uint64_t board = t->board;  // each task works on its own board and pieces;
+	struct Piece pieces[NPIECES];
+	memcpy(pieces, t->pieces, sizeof pieces);
 
-	} else if(rotation == 2) {  // 180 degrees;
+	struct Search search = {.fp = fp, .depth = parent->split_depth, .split_depth = -1, .prune = parent->prune, .symmetric = parent->symmetric, .expand = parent->expand, .count = parent->count, .binary = parent->binary, .iterative = parent->iterative, .used = used_pieces(pieces), .skip = t->skip};
+	search_rows(&board, pieces, t->which_row, &search);
 
-		x_max = piece->actual_x_range;
-		y_max = piece->y_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+	add_stats(stats, &search.stats);
+}
 
-				tmp_board[y][x] = board[which_row+y][x0+x] + (*(piece->version))[y_max-1-y][x_max-1-x];
 
-				if(tmp_board[y][x] > 1) {  // check if pieces overlap;
-					return -1;
-				}
-			}
-		}
+/**
+ * Runs the row search from the given row with the engine selected by search->iterative.
+ */
+void search_rows(uint64_t* board, struct Piece* pieces, short const which_row, struct Search* search) {
+	if(search->iterative) iter_rows_stack(board, pieces, which_row, search);
+	else iter_rows(board, pieces, which_row, search);
+}
 
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
 
-				board[which_row+y][x0+x] = tmp_board[y][x];  // if there is no overlap copy the board values from the temp array to the board array;
-			}
-		}
+/**
+ * Records the current state of the search as a task and leaves the pieces in the state the search of the task's subtree would leave them in.
+ *
+ * @see struct Task
+ *
+ */
+void add_task(struct Search* search, uint64_t board, struct Piece* pieces, short const which_row) {
 
-	} else {  // rotation == 3, 270 degrees;
+	if(search->ntasks == search->max_tasks) {
+		search->max_tasks = (search->max_tasks == 0) ? 1024 : 2*search->max_tasks;
+		search->tasks = realloc(search->tasks, search->max_tasks * sizeof *(search->tasks));
+	}
 
-		x_max = piece->y_range;
-		y_max = piece->actual_x_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+	struct Task* t = &search->tasks[search->ntasks];
+	t->board = board;
+	memcpy(t->pieces, pieces, sizeof t->pieces);
+	t->skip = search->skip;
+	t->which_row = which_row;
+	search->ntasks += 1;
 
-				tmp_board[y][x] = board[which_row+y][x0+x] + (*(piece->version))[x][y_max-1-y];
+	skip_unused_pieces(search);
+}
 
-				if(tmp_board[y][x] > 1) {  // check if pieces overlap;
-					return -1;
-				}
-			}
-		}
 
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+/**
+ * Puts all unused pieces on skip.
+ *
+ * A completely searched subtree of iter_rows always returns with all unused pieces on skip (its innermost recursion
+ * skips every piece that is left) and the parent's subsequent search relies on that. Whenever a subtree is not searched
+ * right away (task, pruning) this must be called instead in order to find the same solutions in the same order.
+ *
+ * @param search -- pointer to the context of the search.
+ *
+ */
+void skip_unused_pieces(struct Search* search) {
+	search->skip |= ALL_PIECES & ~search->used;
+}
 
-				board[which_row+y][x0+x] = tmp_board[y][x];  // if there is no overlap copy the board values from the temp array to the board array;
-			}
-		}
-	}
 
-	return 0;
+/**
+ * Adds the counters of a search to the total.
+ */
+void add_stats(struct Stats* total, struct Stats const* stats) {
+	total->nsolutions += stats->nsolutions;
+	total->nnodes += stats->nnodes;
+	total->npruned_small += stats->npruned_small;
+	total->npruned_sum += stats->npruned_sum;
 }
 
 
 /**
- * Removes a (already placed) piece from the board.
+ * Iterates over the rows of the board, trying to complete one by one.
  *
- * @param board -- pointer to the two-dimensional array representing the board.
- * @param piece -- pointer to the piece that is to be placed.
+ * @param board -- pointer to the bitboard representing the board.
+ * @param pieces -- pointer to the array of all pieces.
  * @param which_row -- indicates which row the algorithm is currently working on.
- * @param x0 -- indicates the x-position of the left upper corner of the enclosing rectangle within which the piece will be placed.
- * @param rotation -- indicates the rotation of the piece.
- *
- * @see place_piece_on_board 
+ * @param search -- pointer to the context of the search (output file, task splitting, counters).
  *
  */
-void remove_piece_from_board(short board[][5], struct Piece* piece, short const which_row, short const x0, short const rotation) {
+void iter_rows(uint64_t* board, struct Piece* pieces, short const which_row, struct Search* search) {
 
-	short y_max, x_max;
+	search->stats.nnodes += 1;
+	if(search->budget && (search->stats.nnodes & 0xfff) == 0 && search_interrupted(search)) return;  // poll the clock only every 4096 nodes;
 
-	if(rotation == 0) {
+	if(search->depth == search->split_depth) {  // leave the subtree to a worker thread;
+		add_task(search, *board, pieces, which_row);
+		return;
+	}
 
-		x_max = piece->actual_x_range;
-		y_max = piece->y_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+	if(which_row == BOARD_HEIGHT) {  // last row was finished by placing a piece (purple) only within that row;
+		write_solution(search, pieces);
+		return;
+	}
 
-				board[which_row+y][x0+x] -= (*(piece->version))[y][x];
-			}
+	if((*board & ROW_MASK(which_row)) == ROW_MASK(which_row)) {  // row is already complete;
+		if(which_row == BOARD_HEIGHT-1) {  // is the last row;
+			skip_unused_pieces(search);  // set each unused piece on skip because skipped pieces are set on unskip after a row was completed in order to make them available for the next row. However there is no additional row after the last one and in case of solutions including only 9 pieces having unused, unskipped pieces can result in an infinite loop (as they will be used in place of the piece that completed the board in subsequent steps which makes it possible to use the completing piece again). Therefore skip them in case the algorithm found a solution.
+			write_solution(search, pieces);
+		} else {  // is not the last row;
+			iter_rows(board, pieces, which_row+1, search);  // move on to the next row;
 		}
+		return;
+	}
 
-	} else if(rotation == 1) {
+	uint16_t const available = ALL_PIECES & ~(search->used | search->skip);
+	if(available == 0) return;  // All pieces are either used or on skip for the current row -> no solution could be found.
+	short const nused = __builtin_ctz(available);  // how many successive pieces (without gap, from the beginning) have already been used or are currently on skip. At the same time this indicates the position of the piece that will be used this step withing the array of pieces.
+	struct Piece* piece = &pieces[nused];
 
-		x_max = piece->y_range;
-		y_max = piece->actual_x_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+	short const group = nused*BOARD_HEIGHT + which_row;
+	short const first = first_placement[group];
+	for(uint64_t legal = legal_placements(*board, placement_masks + first, first_placement[group+1] - first); legal != 0; legal &= legal-1) {  // loop over all distinct placements of the piece whose enclosing rectangle starts in the current row and that don't overlap placed pieces (ordered by rotation, version and x, see placements.h); the board is the same for each of them, so they are tested at once;
 
-				board[which_row+y][x0+x] -= (*(piece->version))[x_max-1-x][y];
-			}
-		}
+		short const k = first + __builtin_ctzll(legal);
+		if(search->symmetric && nused == SYMMETRY_PIECE && is_canonical(k) == 0) continue;  // a symmetric image of this placement is used instead;
 
-	} else if(rotation == 2) {
+		struct Placement const* placement = &placements[k];
+		*board |= placement->mask;
 
-		x_max = piece->actual_x_range;
-		y_max = piece->y_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
+		piece->used = placement->used;  // mark piece as used (see declaration of Piece for encoding);
+		piece->placement = k;
+		search->used |= 1 << nused;
+		search->depth += 1;
+		if(search->prune && prune_dead_region(*board, placement->mask, pieces, &search->stats)) {  // the remaining empty sites can't be filled;
 
-				board[which_row+y][x0+x] -= (*(piece->version))[y_max-1-y][x_max-1-x];
-			}
+			skip_unused_pieces(search);
+		} else if((*board & ROW_MASK(which_row)) == ROW_MASK(which_row)) {  // current row is complete;
+
+			search->skip = 0;  // reset skip of pieces in order to make them available for the next row;
+			iter_rows(board, pieces, which_row+1, search);  // move on to the next row;
+		} else {  // row is not complete;
+
+			iter_rows(board, pieces, which_row, search);  // stay within the current row;
 		}
+		remove_piece_from_board(board, placement);  // after deeper recursions returned remove the piece from the board in order to place it at another location or to skip it for the current row;
+		piece->used = 0;  // adjust used indicator;
+		search->used &= ~(1 << nused);
+		search->depth -= 1;
+		if(search->stop) return;  // unwind without searching further;
+		search->skip &= (2 << nused) - 1;  // reset skip of subsequent pieces so they can be used in the current row (their skip was set in deeper recursions); preceding pieces, if skipped, remain unchanged as their combination with other pieces was already checked in higher recursion levels (only 'forward' (or better 'downward') generation of combinations, no double generation);
+	}
 
-	} else {  // rotation == 3;
+	// finally, do not use the current piece for the current row (so it can be used for subsequent rows);
+	search->skip |= 1 << nused;
+	iter_rows(board, pieces, which_row, search);  // stay within the current row;
+}
 
-		x_max = piece->y_range;
-		y_max = piece->actual_x_range;
-		for(short x=0; x<x_max; ++x) {
-			for(short y=0; y<y_max; ++y) {
 
-				board[which_row+y][x0+x] -= (*(piece->version))[x][y_max-1-y];
-			}
-		}
+
+/**
+ * Places a piece on the board, if possible.
+ * 
+ * @param board -- pointer to the bitboard representing the board.
+ * @param placement -- pointer to the placement (piece, version, rotation and position) that is to be put on the board.
+ *
+ * @return 0 if the piece was successfully placed, -1 if the piece could not be placed due to overlap with another piece.
+ *
+ */
+int place_piece_on_board(uint64_t* board, struct Placement const* placement) {
+
+	if(*board & placement->mask) {  // check if pieces overlap;
+		return -1;
 	}
+	*board |= placement->mask;
+
+	return 0;
 }
 
 
 /**
- * Creates the pieces.
+ * Removes a (already placed) piece from the board.
  *
- * @param pieces -- pointer to the array of all pieces.
+ * @param board -- pointer to the bitboard representing the board.
+ * @param placement -- pointer to the placement of the piece.
  *
- * @see struct Piece
+ * @see place_piece_on_board 
  *
  */
-void create_pieces(struct Piece* pieces) {
-
-	// white
-	pieces[0].y_range = 2;
-	pieces[0].actual_x_range = 2;
-	pieces[0].x_range_A[0] = 1;
-	pieces[0].x_range_A[1] = 2;
-	pieces[0].x_range_A[2] = 2;
-	pieces[0].x_range_A[3] = 1;
-	pieces[0].A[0][0] = 1; pieces[0].A[0][1] = 0;
-	pieces[0].A[1][0] = 1; pieces[0].A[1][1] = 1;
-
-	pieces[0].rotations[0] = 1;
-	pieces[0].rotations[1] = 1;
-	pieces[0].rotations[2] = 1;
-	pieces[0].rotations[3] = 1;
-
-	pieces[0].symmetric = 1;
-
-
-
-	// lightgreen
-	pieces[1].y_range = 2;
-	pieces[1].actual_x_range = 2;
-	pieces[1].x_range_A[0] = 2;
-	pieces[1].x_range_A[1] = 2;
-	pieces[1].x_range_A[2] = 2;
-	pieces[1].x_range_A[3] = 2;
-	pieces[1].A[0][0] = 1; pieces[1].A[0][1] = 1;
-	pieces[1].A[1][0] = 1; pieces[1].A[1][1] = 1;
-
-	pieces[1].rotations[0] = 1;
-	pieces[1].rotations[1] = 0;
-	pieces[1].rotations[2] = 0;
-	pieces[1].rotations[3] = 0;
-
-	pieces[1].symmetric = 1;
-
-
-
-	// orange
-	pieces[2].y_range = 3;
-	pieces[2].actual_x_range = 2;
-	pieces[2].x_range_A[0] = 1;
-	pieces[2].x_range_A[1] = 3;
-	pieces[2].x_range_A[2] = 2;
-	pieces[2].x_range_A[3] = 1;
-	pieces[2].A[0][0] = 1; pieces[2].A[0][1] = 0;
-	pieces[2].A[1][0] = 1; pieces[2].A[1][1] = 0;
-	pieces[2].A[2][0] = 1; pieces[2].A[2][1] = 1;
-
-	pieces[2].rotations[0] = 1;
-	pieces[2].rotations[1] = 1;
-	pieces[2].rotations[2] = 1;
-	pieces[2].rotations[3] = 1;
-
-	pieces[2].x_range_B[0] = 1;
-	pieces[2].x_range_B[1] = 1;
-	pieces[2].x_range_B[2] = 2;
-	pieces[2].x_range_B[3] = 3;
-	pieces[2].B[0][0] = 0; pieces[2].B[0][1] = 1;
-	pieces[2].B[1][0] = 0; pieces[2].B[1][1] = 1;
-	pieces[2].B[2][0] = 1; pieces[2].B[2][1] = 1;
-
-
-
-	// darkblue
-	pieces[3].y_range = 4;
-	pieces[3].actual_x_range = 1;
-	pieces[3].x_range_A[0] = 1;
-	pieces[3].x_range_A[1] = 4;
-	pieces[3].x_range_A[2] = 1;
-	pieces[3].x_range_A[3] = 4;
-	pieces[3].A[0][0] = 1;
-	pieces[3].A[1][0] = 1;
-	pieces[3].A[2][0] = 1;
-	pieces[3].A[3][0] = 1;
-
-	pieces[3].rotations[0] = 1;
-	pieces[3].rotations[1] = 1;
-	pieces[3].rotations[2] = 0;
-	pieces[3].rotations[3] = 0;
-
-	pieces[3].symmetric = 1;
-
-
-
-	// grey
-	pieces[4].y_range = 3;
-	pieces[4].actual_x_range = 3;
-	pieces[4].x_range_A[0] = 1;
-	pieces[4].x_range_A[1] = 1;
-	pieces[4].x_range_A[2] = 1;
-	pieces[4].x_range_A[3] = 1;
-	pieces[4].A[0][0] = 0; pieces[4].A[0][1] = 1; pieces[4].A[0][2] = 0;
-	pieces[4].A[1][0] = 1; pieces[4].A[1][1] = 1; pieces[4].A[1][2] = 1;
-	pieces[4].A[2][0] = 0; pieces[4].A[2][1] = 1; pieces[4].A[2][2] = 0;
-
-	pieces[4].rotations[0] = 1;
-	pieces[4].rotations[1] = 0;
-	pieces[4].rotations[2] = 0;
-	pieces[4].rotations[3] = 0;
-
-	pieces[4].symmetric = 1;
-
-
-
-	// red
-	pieces[5].y_range = 3;
-	pieces[5].actual_x_range = 2;
-	pieces[5].x_range_A[0] = 1;
-	pieces[5].x_range_A[1] = 3;
-	pieces[5].x_range_A[2] = 2;
-	pieces[5].x_range_A[3] = 2;
-	pieces[5].A[0][0] = 1; pieces[5].A[0][1] = 0;
-	pieces[5].A[1][0] = 1; pieces[5].A[1][1] = 1;
-	pieces[5].A[2][0] = 1; pieces[5].A[2][1] = 1;
-
-	pieces[5].rotations[0] = 1;
-	pieces[5].rotations[1] = 1;
-	pieces[5].rotations[2] = 1;
-	pieces[5].rotations[3] = 1;
-
-	pieces[5].x_range_B[0] = 1;
-	pieces[5].x_range_B[1] = 2;
-	pieces[5].x_range_B[2] = 2;
-	pieces[5].x_range_B[3] = 3;
-	pieces[5].B[0][0] = 0; pieces[5].B[0][1] = 1;
-	pieces[5].B[1][0] = 1; pieces[5].B[1][1] = 1;
-	pieces[5].B[2][0] = 1; pieces[5].B[2][1] = 1;
-
-
-
-	// darkgreen
-	pieces[6].y_range = 4;
-	pieces[6].actual_x_range = 2;
-	pieces[6].x_range_A[0] = 1;
-	pieces[6].x_range_A[1] = 2;
-	pieces[6].x_range_A[2] = 1;
-	pieces[6].x_range_A[3] = 3;
-	pieces[6].A[0][0] = 1; pieces[6].A[0][1] = 0;
-	pieces[6].A[1][0] = 1; pieces[6].A[1][1] = 1;
-	pieces[6].A[2][0] = 0; pieces[6].A[2][1] = 1;
-	pieces[6].A[3][0] = 0; pieces[6].A[3][1] = 1;
-
-	pieces[6].rotations[0] = 1;
-	pieces[6].rotations[1] = 1;
-	pieces[6].rotations[2] = 1;
-	pieces[6].rotations[3] = 1;
-
-	pieces[6].x_range_B[0] = 1;
-	pieces[6].x_range_B[1] = 3;
-	pieces[6].x_range_B[2] = 1;
-	pieces[6].x_range_B[3] = 2;
-	pieces[6].B[0][0] = 0; pieces[6].B[0][1] = 1;
-	pieces[6].B[1][0] = 1; pieces[6].B[1][1] = 1;
-	pieces[6].B[2][0] = 1; pieces[6].B[2][1] = 0;
-	pieces[6].B[3][0] = 1; pieces[6].B[3][1] = 0;
-
-
-
-	// yellow
-	pieces[7].y_range = 3;
-	pieces[7].actual_x_range = 2;
-	pieces[7].x_range_A[0] = 2;
-	pieces[7].x_range_A[1] = 3;
-	pieces[7].x_range_A[2] = 2;
-	pieces[7].x_range_A[3] = 2;
-	pieces[7].A[0][0] = 1; pieces[7].A[0][1] = 1;
-	pieces[7].A[1][0] = 1; pieces[7].A[1][1] = 0;
-	pieces[7].A[2][0] = 1; pieces[7].A[2][1] = 1;
-
-	pieces[7].rotations[0] = 1;
-	pieces[7].rotations[1] = 1;
-	pieces[7].rotations[2] = 1;
-	pieces[7].rotations[3] = 1;
-
-	pieces[7].symmetric = 1;
-
-
-
-	// lightblue
-	pieces[8].y_range = 3;
-	pieces[8].actual_x_range = 3;
-	pieces[8].x_range_A[0] = 1;
-	pieces[8].x_range_A[1] = 3;
-	pieces[8].x_range_A[2] = 3;
-	pieces[8].x_range_A[3] = 1;
-	pieces[8].A[0][0] = 1; pieces[8].A[0][1] = 0; pieces[8].A[0][2] = 0;
-	pieces[8].A[1][0] = 1; pieces[8].A[1][1] = 0; pieces[8].A[1][2] = 0;
-	pieces[8].A[2][0] = 1; pieces[8].A[2][1] = 1; pieces[8].A[2][2] = 1;
-
-	pieces[8].rotations[0] = 1;
-	pieces[8].rotations[1] = 1;
-	pieces[8].rotations[2] = 1;
-	pieces[8].rotations[3] = 1;
-
-	pieces[8].symmetric = 1;
-
-
-
-	// rose
-	pieces[9].y_range = 3;
-	pieces[9].actual_x_range = 3;
-	pieces[9].x_range_A[0] = 1;
-	pieces[9].x_range_A[1] = 2;
-	pieces[9].x_range_A[2] = 2;
-	pieces[9].x_range_A[3] = 1;
-	pieces[9].A[0][0] = 1; pieces[9].A[0][1] = 0; pieces[9].A[0][2] = 0;
-	pieces[9].A[1][0] = 1; pieces[9].A[1][1] = 1; pieces[9].A[1][2] = 0;
-	pieces[9].A[2][0] = 0; pieces[9].A[2][1] = 1; pieces[9].A[2][2] = 1;
-
-	pieces[9].rotations[0] = 1;
-	pieces[9].rotations[1] = 1;
-	pieces[9].rotations[2] = 1;
-	pieces[9].rotations[3] = 1;
-
-	pieces[9].symmetric = 1;
-
-
-
-	// pinkish
-	pieces[10].y_range = 4;
-	pieces[10].actual_x_range = 2;
-	pieces[10].x_range_A[0] = 1;
-	pieces[10].x_range_A[1] = 4;
-	pieces[10].x_range_A[2] = 1;
-	pieces[10].x_range_A[3] = 1;
-	pieces[10].A[0][0] = 1; pieces[10].A[0][1] = 0;
-	pieces[10].A[1][0] = 1; pieces[10].A[1][1] = 0;
-	pieces[10].A[2][0] = 1; pieces[10].A[2][1] = 1;
-	pieces[10].A[3][0] = 1; pieces[10].A[3][1] = 0;
-
-	pieces[10].rotations[0] = 1;
-	pieces[10].rotations[1] = 1;
-	pieces[10].rotations[2] = 1;
-	pieces[10].rotations[3] = 1;
-
-	pieces[10].x_range_B[0] = 1;
-	pieces[10].x_range_B[1] = 1;
-	pieces[10].x_range_B[2] = 1;
-	pieces[10].x_range_B[3] = 4;
-	pieces[10].B[0][0] = 0; pieces[10].B[0][1] = 1;
-	pieces[10].B[1][0] = 0; pieces[10].B[1][1] = 1;
-	pieces[10].B[2][0] = 1; pieces[10].B[2][1] = 1;
-	pieces[10].B[3][0] = 0; pieces[10].B[3][1] = 1;
-
-
-
-	// blue
-	pieces[11].y_range = 4;
-	pieces[11].actual_x_range = 2;
-	pieces[11].x_range_A[0] = 1;
-	pieces[11].x_range_A[1] = 4;
-	pieces[11].x_range_A[2] = 2;
-	pieces[11].x_range_A[3] = 1;
-	pieces[11].A[0][0] = 1; pieces[11].A[0][1] = 0;
-	pieces[11].A[1][0] = 1; pieces[11].A[1][1] = 0;
-	pieces[11].A[2][0] = 1; pieces[11].A[2][1] = 0;
-	pieces[11].A[3][0] = 1; pieces[11].A[3][1] = 1;
-
-	pieces[11].rotations[0] = 1;
-	pieces[11].rotations[1] = 1;
-	pieces[11].rotations[2] = 1;
-	pieces[11].rotations[3] = 1;
-
-	pieces[11].x_range_B[0] = 1;
-	pieces[11].x_range_B[1] = 1;
-	pieces[11].x_range_B[2] = 2;
-	pieces[11].x_range_B[3] = 4;
-	pieces[11].B[0][0] = 0; pieces[11].B[0][1] = 1;
-	pieces[11].B[1][0] = 0; pieces[11].B[1][1] = 1;
-	pieces[11].B[2][0] = 0; pieces[11].B[2][1] = 1;
-	pieces[11].B[3][0] = 1; pieces[11].B[3][1] = 1;
-}
\ No newline at end of file
+void remove_piece_from_board(uint64_t* board, struct Placement const* placement) {
+
+	*board ^= placement->mask;
+}
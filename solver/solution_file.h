@@ -0,0 +1,75 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef SOLUTION_FILE_H
+#define SOLUTION_FILE_H
+
+#include <stdint.h>
+#include "placements.h"
+
+/**
+ * Binary solution file: a header followed by one fixed-size record per solution, in the order the solutions were found
+ * (solution n starts at byte sizeof(struct SolutionFileHeader) + n*SOLUTION_RECORD_SIZE). All numbers are little-endian.
+ *
+ * A record stores for each piece the offset of its placement from the first placement of the piece in placements
+ * (at most 264 placements per piece, i.e. 9 bits): byte i holds the low 8 bits of the offset of piece i, the two bytes
+ * following the twelve hold the 9th bit of piece i in bit i.
+ */
+
+#define SOLUTION_FILE_MAGIC "LPSF"
+#define SOLUTION_FILE_VERSION 1
+#define SOLUTION_RECORD_SIZE (NPIECES + 2)
+
+struct SolutionFileHeader {
+	char magic[4];  // SOLUTION_FILE_MAGIC (without terminating zero);
+	uint16_t version;  // SOLUTION_FILE_VERSION;
+	uint16_t record_size;  // SOLUTION_RECORD_SIZE;
+	uint32_t nplacements;  // NPLACEMENTS of the table the records refer to;
+	uint32_t nsolutions;  // number of records following the header;
+};
+
+
+/**
+ * Packs a solution into a record.
+ *
+ * @param record -- output, SOLUTION_RECORD_SIZE bytes.
+ * @param placement_of_piece -- index into placements of the placement of each piece.
+ *
+ */
+static inline void encode_solution_record(unsigned char* record, short const* placement_of_piece) {
+	unsigned high = 0;
+	for(short i=0; i<NPIECES; ++i) {
+		int const offset = placement_of_piece[i] - first_placement[i*BOARD_HEIGHT];
+		record[i] = offset & 0xff;
+		high |= (unsigned)(offset >> 8) << i;
+	}
+	record[NPIECES] = high & 0xff;
+	record[NPIECES+1] = high >> 8;
+}
+
+
+/**
+ * @return index into placements of the placement of the piece in the record.
+ */
+static inline int decode_solution_record(unsigned char const* record, short piece) {
+	return first_placement[piece*BOARD_HEIGHT] + record[piece] + (((record[NPIECES + piece/8] >> (piece%8)) & 1) << 8);
+}
+
+#endif // SOLUTION_FILE_H
@@ -0,0 +1,141 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "reorder.h"
+#include "writer.h"
+
+/**
+ * The board is stored as a bitboard: site (y, x) corresponds to bit y*BOARD_WIDTH + x, i.e. row y occupies bits
+ * BOARD_WIDTH*y to BOARD_WIDTH*y + BOARD_WIDTH-1. All sites fit into a single 64-bit integer (gen_placements allows at
+ * most 63); occupied sites are denoted with 1s, free sites with 0s.
+ */
+#define ROW_MASK(y) ((((uint64_t)1 << BOARD_WIDTH) - 1) << (BOARD_WIDTH*(y)))  // all sites of row y;
+#define FULL_BOARD (((uint64_t)1 << (BOARD_HEIGHT*BOARD_WIDTH)) - 1)  // all sites of the board;
+#define COLUMN_MASK(x) ((FULL_BOARD / ROW_MASK(0)) << (x))  // all sites of column x (1 + 2^w + 2^2w + ... == FULL_BOARD / (2^w - 1));
+
+#include "placements.h"
+
+struct Piece {
+	int used;  // indicates whether the piece was already used and in which configuration (0: unused, <version>*1000 + <rotation>*100 + <y>*10 + <x>: oterhwise (where <version> is 1 for A and 2 for B));
+	short placement;  // index into placements of the current configuration (only valid if used);
+};
+
+#define ALL_PIECES ((1 << NPIECES) - 1)  // bit i: piece i;
+
+/**
+ * @return the set of pieces that are on the board (bit i: piece i).
+ */
+static inline uint16_t used_pieces(struct Piece const* pieces) {
+	uint16_t used = 0;
+	for(short i=0; i<NPIECES; ++i) {
+		if(pieces[i].used != 0) used |= 1 << i;
+	}
+	return used;
+}
+
+/**
+ * State of a subtree of the row search: the board and pieces after the first split_depth pieces were placed.
+ */
+struct Task {
+	uint64_t board;
+	struct Piece pieces[NPIECES];
+	uint16_t skip;  // pieces on skip for which_row (see Search);
+	short which_row;
+};
+
+/**
+ * Counters of a search.
+ */
+struct Stats {
+	long long nsolutions;  // number of solutions found;
+	long long nnodes;  // number of nodes (calls of iter_rows or iter_cells) of the search tree;
+	long long npruned_small;  // nodes pruned because an empty region is smaller than the smallest unused piece;
+	long long npruned_sum;  // nodes pruned because the size of an empty region is no sum of sizes of unused pieces;
+};
+
+#define STOP_NONE 0
+#define STOP_LIMIT 1  // a solution beyond the requested number was found;
+#define STOP_TIME 2  // the time budget is used up;
+
+/**
+ * Context of a (sequential) search.
+ */
+struct Search {
+	FILE* fp;  // output file;
+	short depth;  // number of pieces currently placed on the board;
+	short split_depth;  // if the search reaches this depth it records a task instead of descending further (-1: never);
+	struct Task* tasks;  // recorded tasks in the order of the sequential search;
+	int ntasks;
+	int max_tasks;
+	struct Reorder* reorder;  // puts the output of the tasks in the order of the sequential search;
+	struct Writer* writer;  // if not NULL, solutions are handed to the writer thread instead of being written to fp;
+	struct Stats stats;
+	struct Stats* worker_stats;  // counters of the tasks, summed up per worker thread;
+	short fewest;  // iter_cells: 0: branch on the first empty site, 1: branch on the empty site with the fewest placements;
+	short prune;  // 1: check for empty regions that can't be filled after each placement (see prune_dead_region);
+	short symmetric;  // 1: only use one placement of SYMMETRY_PIECE out of each set of symmetric placements (see is_canonical);
+	short expand;  // 1: write each solution together with its three symmetric images;
+	short count;  // 1: only count the solutions, don't write them (fp is NULL);
+	short iterative;  // rows: 1: use iter_rows_stack, 0: iter_rows;
+	short binary;  // 1: write the solutions as records of the binary format (see solution_file.h), 0: as text;
+	long long limit;  // stop after this many solutions (0: no limit);
+	short budget;  // 1: stop at deadline;
+	struct timespec deadline;  // CLOCK_MONOTONIC;
+	short stop;  // why the search stopped early (STOP_NONE, STOP_LIMIT or STOP_TIME);
+	uint64_t board_hash;  // checkpoint: identifies the pieces placed before the search (see checkpoint_board_hash);
+	uint16_t used;  // iter_rows: pieces on the board (bit i: piece i);
+	uint16_t skip;  // iter_rows: pieces that are skipped for the current row;
+};
+
+/**
+ * @return 1 if placement k has the smallest index among its images under the symmetries of the board, 0 otherwise.
+ */
+static inline int is_canonical(short const k) {
+	return k < symmetric_placements[k][0] && k < symmetric_placements[k][1] && k < symmetric_placements[k][2];
+}
+
+extern uint64_t placement_masks[NPLACEMENTS];
+extern uint64_t (*legal_placements)(uint64_t board, uint64_t const* masks, short n);  // bit k is set if masks[k] doesn't overlap board (n <= 64);
+
+void iter_rows(uint64_t* board, struct Piece* pieces, short const which_row, struct Search* search);
+void iter_rows_stack(uint64_t* board, struct Piece* pieces, short which_row, struct Search* search);
+void iter_cells(uint64_t* board, struct Piece* pieces, struct Search* search);
+int place_piece_on_board(uint64_t* board, struct Placement const* placement);
+void remove_piece_from_board(uint64_t* board, struct Placement const* placement);
+void write_combination_to_file(FILE* fp, struct Piece* pieces);
+void write_record_to_file(FILE* fp, struct Piece* pieces);
+void write_solution(struct Search* search, struct Piece* pieces);
+void skip_unused_pieces(struct Search* search);
+void add_task(struct Search* search, uint64_t board, struct Piece* pieces, short const which_row);
+int search_interrupted(struct Search* search);
+void add_stats(struct Stats* total, struct Stats const* stats);
+void prune_init();
+short largest_placement_group();
+char const* legal_init(char const* kernel);
+long long frontier_count(uint64_t board, struct Piece const* pieces, struct Stats* stats);
+int prune_dead_region(uint64_t const board, uint64_t const placed, struct Piece const* pieces, struct Stats* stats);
+
+#endif // SOLVER_H
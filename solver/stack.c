@@ -0,0 +1,133 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdint.h>
+#include "solver.h"
+
+/**
+ * Placement in progress of the row search: the rest of the loop of iter_rows over the placements of a piece.
+ */
+struct Frame {
+	uint64_t legal;  // placements that are still to be tried (bit k: first_placement[group] + k, see legal_placements);
+	short first;  // first_placement[group];
+	short placement;  // index into placements of the placement that is on the board;
+	char row;  // which_row of the loop;
+	char piece;  // the piece that is placed;
+};
+
+
+/**
+ * Runs the same search as iter_rows (same solutions in the same order, same counters and the same effect on the pieces
+ * and the search) but keeps the placements in progress in a fixed-size array of frames instead of on the call stack.
+ *
+ * Only placements push a frame: each skip and each move to the next row is the last thing a call of iter_rows does, so
+ * it just continues with the new row. There are therefore never more than NPIECES frames.
+ *
+ * @param board -- pointer to the bitboard representing the board.
+ * @param pieces -- pointer to the array of all pieces.
+ * @param which_row -- the row to start with.
+ * @param search -- pointer to the context of the search.
+ *
+ */
+void iter_rows_stack(uint64_t* board, struct Piece* pieces, short which_row, struct Search* search) {
+
+	struct Frame stack[NPIECES];
+	short top = 0;  // number of frames; each of them has a placement on the board while a node above it is visited;
+	struct Frame* frame;
+	short row = which_row;
+
+visit:  // a node of row (a call of iter_rows);
+	search->stats.nnodes += 1;
+	if(search->budget && (search->stats.nnodes & 0xfff) == 0 && search_interrupted(search)) goto backtrack;
+
+	if(search->depth == search->split_depth) {
+		add_task(search, *board, pieces, row);
+		goto backtrack;
+	}
+	if(row == BOARD_HEIGHT) {
+		write_solution(search, pieces);
+		goto backtrack;
+	}
+	if((*board & ROW_MASK(row)) == ROW_MASK(row)) {  // row is already complete;
+		if(row == BOARD_HEIGHT-1) {
+			skip_unused_pieces(search);  // see iter_rows;
+			write_solution(search, pieces);
+			goto backtrack;
+		}
+		row += 1;
+		goto visit;
+	}
+
+	uint16_t const available = ALL_PIECES & ~(search->used | search->skip);
+	if(available == 0) goto backtrack;
+
+	frame = &stack[top++];
+	frame->row = row;
+	frame->piece = __builtin_ctz(available);
+	frame->first = first_placement[frame->piece*BOARD_HEIGHT + row];
+	frame->legal = legal_placements(*board, placement_masks + frame->first, first_placement[frame->piece*BOARD_HEIGHT + row + 1] - frame->first);
+
+next:  // try the next placement of the top frame;
+	while(frame->legal != 0) {
+		short const k = frame->first + __builtin_ctzll(frame->legal);
+		frame->legal &= frame->legal-1;
+		if(search->symmetric && frame->piece == SYMMETRY_PIECE && is_canonical(k) == 0) continue;
+
+		struct Placement const* placement = &placements[k];
+		*board |= placement->mask;
+		pieces[(short)frame->piece].used = placement->used;
+		pieces[(short)frame->piece].placement = k;
+		search->used |= 1 << frame->piece;
+		search->depth += 1;
+		frame->placement = k;
+
+		if(search->prune && prune_dead_region(*board, placement->mask, pieces, &search->stats)) {
+			skip_unused_pieces(search);
+			goto undo;
+		}
+		if((*board & ROW_MASK(frame->row)) == ROW_MASK(frame->row)) {  // row is complete;
+			search->skip = 0;
+			row = frame->row + 1;
+		} else {
+			row = frame->row;
+		}
+		goto visit;
+	}
+	top -= 1;  // all placements were tried: skip the piece for the row;
+	search->skip |= 1 << frame->piece;
+	row = frame->row;
+	goto visit;
+
+backtrack:  // the node is done, return to the placement in progress of the top frame;
+	if(top == 0) return;
+	frame = &stack[top-1];
+
+undo:
+	*board ^= placements[frame->placement].mask;
+	pieces[(short)frame->piece].used = 0;
+	search->used &= ~(1 << frame->piece);
+	search->depth -= 1;
+	if(search->stop) {  // unwind without searching further;
+		top -= 1;
+		goto backtrack;
+	}
+	search->skip &= (2 << frame->piece) - 1;  // see iter_rows;
+	goto next;
+}
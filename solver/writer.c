@@ -0,0 +1,148 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#include <stdlib.h>
+#include "solver.h"
+#include "writer.h"
+
+
+/**
+ * Wakes up the other side if it waits on cond. The caller has published its progress with a sequentially consistent
+ * store, and the waiting side sets its flag before it checks the ring again, so at least one of them sees the other.
+ */
+static void wake(struct Writer* writer, atomic_int* waiting, pthread_cond_t* cond) {
+	if(atomic_load(waiting)) {
+		pthread_mutex_lock(&writer->mutex);
+		pthread_cond_signal(cond);
+		pthread_mutex_unlock(&writer->mutex);
+	}
+}
+
+
+/**
+ * Writer thread: formats all records that are available at once, then publishes the new tail.
+ */
+static void* run_writer(void* data) {
+
+	struct Writer* writer = data;
+	size_t tail = atomic_load_explicit(&writer->tail, memory_order_relaxed);
+
+	for(;;) {
+		int const closed = atomic_load_explicit(&writer->closed, memory_order_acquire);  // load before head, so head contains all records if closed;
+		size_t const head = atomic_load_explicit(&writer->head, memory_order_acquire);
+		if(head == tail) {
+			if(closed) break;
+			pthread_mutex_lock(&writer->mutex);
+			atomic_store(&writer->writer_waiting, 1);
+			while(atomic_load(&writer->head) == tail && atomic_load(&writer->closed) == 0) {
+				pthread_cond_wait(&writer->not_empty, &writer->mutex);
+			}
+			atomic_store(&writer->writer_waiting, 0);
+			pthread_mutex_unlock(&writer->mutex);
+			continue;
+		}
+
+		for(; tail!=head; ++tail) {
+			struct WriterRecord const* record = &writer->ring[tail & (writer->capacity-1)];
+			struct Piece pieces[NPIECES];
+			for(short i=0; i<NPIECES; ++i) {
+				pieces[i].placement = record->placement[i];
+				pieces[i].used = placements[record->placement[i]].used;
+			}
+			if(writer->binary) write_record_to_file(writer->fp, pieces);
+			else write_combination_to_file(writer->fp, pieces);
+		}
+		atomic_store(&writer->tail, tail);  // the slots may be reused;
+		wake(writer, &writer->search_waiting, &writer->not_full);
+	}
+
+	return NULL;
+}
+
+
+/**
+ * Starts the writer thread.
+ *
+ * @param writer -- pointer to the writer.
+ * @param fp -- file the solutions are written to; should have a buffer of WRITER_BUFFER_SIZE bytes (set by the caller
+ *              right after opening it), so the writer thread writes in big chunks.
+ * @param binary -- 1: write records of the binary format (see solution_file.h), 0: write text lines.
+ * @param capacity -- number of records the ring can hold; must be a power of two.
+ *
+ */
+void writer_init(struct Writer* writer, FILE* fp, short binary, size_t capacity) {
+	writer->fp = fp;
+	writer->binary = binary;
+	writer->ring = calloc(capacity, sizeof *(writer->ring));
+	writer->capacity = capacity;
+	atomic_init(&writer->head, 0);
+	atomic_init(&writer->tail, 0);
+	atomic_init(&writer->closed, 0);
+	atomic_init(&writer->writer_waiting, 0);
+	atomic_init(&writer->search_waiting, 0);
+	pthread_mutex_init(&writer->mutex, NULL);
+	pthread_cond_init(&writer->not_empty, NULL);
+	pthread_cond_init(&writer->not_full, NULL);
+	pthread_create(&writer->thread, NULL, run_writer, writer);
+}
+
+
+/**
+ * Hands a solution to the writer thread; waits only if the ring is full. Must always be called from the same thread.
+ *
+ * @param writer -- pointer to the writer.
+ * @param pieces -- pointer to the array of all pieces (all of them are used).
+ *
+ */
+void writer_push(struct Writer* writer, struct Piece const* pieces) {
+
+	size_t const head = atomic_load_explicit(&writer->head, memory_order_relaxed);  // only this thread writes head;
+	if(head - atomic_load_explicit(&writer->tail, memory_order_acquire) == writer->capacity) {  // the ring is full;
+		pthread_mutex_lock(&writer->mutex);
+		atomic_store(&writer->search_waiting, 1);
+		while(head - atomic_load(&writer->tail) == writer->capacity) {
+			pthread_cond_wait(&writer->not_full, &writer->mutex);
+		}
+		atomic_store(&writer->search_waiting, 0);
+		pthread_mutex_unlock(&writer->mutex);
+	}
+
+	struct WriterRecord* record = &writer->ring[head & (writer->capacity-1)];
+	for(short i=0; i<NPIECES; ++i) {
+		record->placement[i] = pieces[i].placement;
+	}
+	atomic_store(&writer->head, head+1);
+	wake(writer, &writer->writer_waiting, &writer->not_empty);
+}
+
+
+/**
+ * Waits until all pushed records are written and stops the writer thread. The file is not closed.
+ */
+void writer_close(struct Writer* writer) {
+	atomic_store(&writer->closed, 1);
+	wake(writer, &writer->writer_waiting, &writer->not_empty);
+	pthread_join(writer->thread, NULL);
+	fflush(writer->fp);
+	pthread_cond_destroy(&writer->not_full);
+	pthread_cond_destroy(&writer->not_empty);
+	pthread_mutex_destroy(&writer->mutex);
+	free(writer->ring);
+}
@@ -0,0 +1,66 @@
+/***************************************************************************************
+ *
+ * This program solves the 2D puzzle "Lonpos 101".
+ * Copyright (C) 2016  Dominik Vilsmeier
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ***************************************************************************************/
+
+#ifndef WRITER_H
+#define WRITER_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "placements.h"
+
+/**
+ * Asynchronous solution writer: the search pushes fixed-size records into a single-producer single-consumer ring
+ * buffer without locking, a dedicated thread formats the records and writes them to the file in batches.
+ *
+ * The search only waits if the ring is full; the writer thread sleeps while the ring is empty. Either side blocks on a
+ * condition variable and the other side takes the mutex only to wake it up.
+ */
+
+#define WRITER_BUFFER_SIZE (1 << 20)  // stdio buffer the output file should get (see setvbuf) before it is written;
+
+struct WriterRecord {
+	short placement[NPIECES];  // index into placements of the placement of each piece;
+};
+
+struct Writer {
+	FILE* fp;  // output file;
+	short binary;  // 1: records of the binary format (see solution_file.h), 0: text lines;
+	struct WriterRecord* ring;
+	size_t capacity;  // number of records in ring (a power of two);
+	atomic_size_t head;  // number of records pushed so far (written by the search);
+	atomic_size_t tail;  // number of records written so far (written by the writer thread);
+	atomic_int closed;  // set by writer_close after the last record was pushed;
+	atomic_int writer_waiting;  // 1 while the writer thread waits for records;
+	atomic_int search_waiting;  // 1 while the search waits for a free slot;
+	pthread_mutex_t mutex;
+	pthread_cond_t not_empty;  // signalled after records were pushed or the writer was closed;
+	pthread_cond_t not_full;  // signalled after records were written;
+	pthread_t thread;
+};
+
+struct Piece;
+
+void writer_init(struct Writer* writer, FILE* fp, short binary, size_t capacity);
+void writer_push(struct Writer* writer, struct Piece const* pieces);
+void writer_close(struct Writer* writer);
+
+#endif // WRITER_H